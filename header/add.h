@@ -42,7 +42,7 @@ class Add : public IArithmetic
      * @param firstA Pointer to first variable for addition.
      * @param secondA Pointer to second variable for addition.
      */
-    Add(Level *lvlA, const std::string &cmdLineA, const uint32_t lineNumberA, ParseObjBase *const firstA = nullptr,
+    Add(Level *lvlA, const std::string &cmdLineA, const uint64_t lineNumberA, ParseObjBase *const firstA = nullptr,
         ParseObjBase *const secondA = nullptr);
 
     /**
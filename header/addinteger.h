@@ -41,7 +41,7 @@ class AddInteger : public IArithmetic
      * @param firstA Pointer to first arithmetic operand (default=nullptr).
      * @param secondA Pointer to second arithmetic operand (default=nullptr).
      */
-    AddInteger(Level *lvlA, const std::string &cmdLineA, const uint32_t &lineNumberA, ParseObjBase *firstA = nullptr,
+    AddInteger(Level *lvlA, const std::string &cmdLineA, const uint64_t &lineNumberA, ParseObjBase *firstA = nullptr,
                ParseObjBase *secondA = nullptr);
 
     /**
@@ -18,6 +18,8 @@
 #ifndef ASSEMBLER_H
 #define ASSEMBLER_H
 
+#include "instructionstream.h"
+#include "logger.h"
 #include <boost/filesystem.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <cstdint>
@@ -57,9 +59,26 @@ class Assembler
      * \param[in] filePathA Path to assembler file
      * \param[in] configA Map of parameters from program configuration file.
      * \param[out] logA Logging stream (default = std::cout)
+     *
+     * \throws AssemblerException if option "General.LogLevel" is not a log level.
      */
     Assembler(boost::filesystem::path &filePathA, boost::property_tree::ptree &configA, std::ostream &logA = std::cout);
 
+    /**
+     * \brief Constructor of an assembler without files.
+     *
+     * \details
+     * The source is parsed from a stream and the machine code is taken from compile,
+     * thus the assembler does not access the file system. Option "General.Output" is
+     * not used.
+     *
+     * \param[in] configA Map of parameters from program configuration file.
+     * \param[out] logA Logging stream
+     *
+     * \throws AssemblerException if option "General.LogLevel" is not a log level.
+     */
+    Assembler(const boost::property_tree::ptree &configA, std::ostream &logA);
+
     // Destructor
     /**
      * \brief Destructor
@@ -73,29 +92,62 @@ class Assembler
     void parse(void);
 
     /**
-     * \brief Create machine code from parsed assembly file
+     * \brief Parse assembler source from a stream for further processing
+     *
+     * \param[in] isA Stream of assembler source.
+     */
+    void parse(std::istream &isA);
+
+    /**
+     * \brief Create machine code from parsed assembly file and write it to the output file
+     *
+     * \throws AssemblerException if the assembler has no output file.
      */
     void assemble(void);
 
+    /**
+     * \brief Create machine code from parsed assembly without writing output files
+     *
+     * \return Assembled machine code words, valid until the assembler is destroyed.
+     */
+    const InstructionStream &compile(void);
+
     /**
      * \brief Write VCGRA machine code to output file.
      */
     // void writeVmcFile(void);
 
   private:
+    /**
+     * \brief Read optimization and report options from configuration.
+     */
+    void readOptions(void);
+
     // Member
-    boost::filesystem::path &m_filePath;
-    //!< \brief Reference to assembler file.
+    boost::filesystem::path m_filePath;
+    //!< \brief Path to assembler file (empty for assembler without files).
     boost::property_tree::ptree m_config;
     //!< \brief Reference to configuration map type.
     boost::filesystem::path m_outPath;
     //!< \brief Path to output file.
     boost::filesystem::path m_outFileName;
     //!< \brief Output file name from configuration file.
-    std::ostream &m_log;
-    //!< \brief Logging string stream (default=std::cout)
+    std::string m_format;
+    //!< \brief Output format from configuration file (default=vector).
+    unsigned m_optLevel;
+    //!< \brief Optimization level from configuration file (default=0).
+    bool m_profile;
+    //!< \brief Estimate execution cycles of loops (default=false).
+    bool m_memoryProfile;
+    //!< \brief Report memory traffic and data reuse of machine code (default=false).
+    Logger m_log;
+    //!< \brief Levelled log output to logging stream (default=std::cout) with level of "General.LogLevel".
     Level *m_firstLevel;
     //!< \brief Pointer to start level of parse document
+    Level *m_currentLevel;
+    //!< \brief Active level of parser for adding new parse objects
+    InstructionStream m_stream;
+    //!< \brief Assembled machine code words of parse document
 
     // Forbidden Constructor
     Assembler &operator=(const Assembler &src) = delete;
@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BATCH_H
+#define BATCH_H
+
+#include <atomic>
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace as
+{
+
+class Instrumentation;
+class Tracer;
+
+/**
+ * @class Batch
+ *
+ * @brief Assemble many assembler files in one process on a pool of threads.
+ *
+ * @details
+ * The configuration is loaded once and shared by all jobs. Every job runs its own
+ * assembler instance and writes its output header and log file to the directory of
+ * "General.Output", named after the assembler file (e.g. conv.asm -> conv.hpp and
+ * conv.log). Worker threads take the next pending job until all jobs are done, thus
+ * long and short programs balance over the threads.
+ */
+class Batch
+{
+  public:
+    /**
+     * @brief Assembler run of one file.
+     */
+    struct Job
+    {
+        boost::filesystem::path file;   //!< @brief Assembler file
+        boost::filesystem::path output; //!< @brief Output header file
+        bool success;                   //!< @brief True, if the file was assembled
+        std::string error;              //!< @brief Error message of failed job
+        double milliseconds;            //!< @brief Wall time of job
+    };
+
+    /**
+     * @brief General constructor
+     *
+     * @param[in] configA Map of parameters from program configuration file (shared by all jobs).
+     * @param[in] threadsA Number of worker threads (0 = number of hardware threads).
+     */
+    Batch(const boost::property_tree::ptree &configA, const unsigned threadsA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~Batch(void) = default;
+
+    /**
+     * @brief Add assembler file as job.
+     *
+     * @throws AssemblerException if another job writes to the same output file.
+     *
+     * @param[in] fileA Assembler file.
+     */
+    void add(const boost::filesystem::path &fileA);
+
+    /**
+     * @brief Add assembler files of a manifest as jobs.
+     *
+     * @details
+     * The manifest lists one assembler file per line. Relative paths are relative to
+     * the manifest, empty lines and lines starting with '#' are ignored.
+     *
+     * @throws AssemblerException if the manifest cannot be read.
+     *
+     * @param[in] manifestA Path to manifest file.
+     */
+    void readManifest(const boost::filesystem::path &manifestA);
+
+    /**
+     * @brief Run all jobs and report results.
+     *
+     * @details
+     * Every worker thread records into its own instrumentation and tracer. They are merged
+     * into the active instrumentation and tracer of the calling thread after all jobs.
+     *
+     * @throws boost::filesystem::filesystem_error if the output directory cannot be created.
+     *
+     * @param[out] osA Output stream for job results and throughput.
+     * @return Number of failed jobs.
+     */
+    uint64_t run(std::ostream &osA);
+
+    /**
+     * @brief Get jobs with results of last run.
+     */
+    const std::vector<Job> &getJobs(void) const;
+
+    /**
+     * @brief Get number of worker threads.
+     */
+    unsigned getThreads(void) const;
+
+  private:
+    /**
+     * @brief Take pending jobs until all jobs are done.
+     *
+     * @param[in,out] nextA Index of next pending job.
+     * @param[out] instA Instrumentation of worker (nullptr disables recording).
+     * @param[out] tracerA Tracer of worker (nullptr disables tracing).
+     */
+    void work(std::atomic<std::size_t> &nextA, Instrumentation *instA, Tracer *tracerA);
+
+    /**
+     * @brief Assemble file of a job.
+     *
+     * @param[in,out] jobA Job to run.
+     */
+    void execute(Job &jobA) const;
+
+    // Forbidden constructors
+    Batch(const Batch &src) = delete;
+    Batch &operator=(const Batch &src) = delete;
+
+    // Member
+    const boost::property_tree::ptree &m_config;
+    //!< @brief Shared configuration of all jobs.
+    unsigned m_threads;
+    //!< @brief Number of worker threads.
+    boost::filesystem::path m_outDir;
+    //!< @brief Directory of output and log files.
+    std::vector<Job> m_jobs;
+    //!< @brief Jobs in order of addition.
+};
+
+} /* End namespace as */
+
+#endif // BATCH_H
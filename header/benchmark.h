@@ -0,0 +1,127 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @class Benchmark
+ *
+ * @brief Run registered benchmarks with repeated samples and report their timing.
+ *
+ * @details
+ * A benchmark body performs a number of operations and returns this number. After one
+ * warm-up run, the runner calibrates how often the body is repeated per sample, so that
+ * a sample takes at least the minimal sample time. The median, minimum and maximum time
+ * per operation of all samples are reported, the median is robust against outliers of
+ * the machine. Output of the bodies to std::cout is suppressed. A failing body is
+ * reported with its error message and does not stop the other benchmarks.
+ */
+class Benchmark
+{
+  public:
+    /**
+     * @brief Timing of a benchmark.
+     */
+    struct Result
+    {
+        std::string name;     //!< @brief Name of benchmark
+        uint64_t operations;  //!< @brief Operations per run of body
+        uint64_t repetitions; //!< @brief Body runs per sample
+        double median;        //!< @brief Median nanoseconds per operation
+        double min;           //!< @brief Minimal nanoseconds per operation
+        double max;           //!< @brief Maximal nanoseconds per operation
+        std::string error;    //!< @brief Error message, if the body failed
+    };
+
+    /**
+     * @brief General constructor
+     *
+     * @param[in] samplesA Number of timed samples per benchmark.
+     * @param[in] minTimeA Minimal time of a sample in milliseconds.
+     */
+    Benchmark(const uint32_t samplesA, const double minTimeA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~Benchmark(void) = default;
+
+    /**
+     * @brief Register a benchmark.
+     *
+     * @param[in] nameA Name of benchmark (e.g. "micro/lookup").
+     * @param[in] bodyA Function which runs the benchmark once and returns the number of operations.
+     */
+    void add(const std::string &nameA, std::function<uint64_t(void)> bodyA);
+
+    /**
+     * @brief Run all benchmarks whose name contains filterA.
+     *
+     * @param[in] filterA Name filter (empty runs all benchmarks).
+     * @param[out] logA Stream to write progress to.
+     */
+    void run(const std::string &filterA, std::ostream &logA);
+
+    /**
+     * @brief Get results of last run.
+     */
+    const std::vector<Result> &getResults(void) const;
+
+    /**
+     * @brief Write results as text table.
+     *
+     * @param[out] osA Output stream to write report to.
+     */
+    void report(std::ostream &osA) const;
+
+    /**
+     * @brief Write results as JSON object.
+     *
+     * @param[out] osA Output stream to write results to.
+     */
+    void writeJson(std::ostream &osA) const;
+
+  private:
+    /**
+     * @brief Time a benchmark body.
+     */
+    Result measure(const std::string &nameA, const std::function<uint64_t(void)> &bodyA) const;
+
+    // Member
+    uint32_t m_samples;
+    //!< @brief Number of timed samples per benchmark.
+    double m_minTime;
+    //!< @brief Minimal time of a sample in milliseconds.
+    std::vector<std::pair<std::string, std::function<uint64_t(void)>>> m_benchmarks;
+    //!< @brief Registered benchmarks in order of registration.
+    std::vector<Result> m_results;
+    //!< @brief Results of last run.
+};
+
+} /* End namespace as */
+
+#endif // BENCHMARK_H
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CONFIGHOISTING_H
+#define CONFIGHOISTING_H
+
+#include "ilevelpass.h"
+#include "instructionset.h"
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace as
+{
+
+// Forward declarations
+class Loop;
+class ParseObjBase;
+
+/**
+ * @class ConfigHoisting
+ *
+ * @brief Hoist loop-invariant configuration loads (LOADPC, LOADCC) out of loops.
+ *
+ * @details
+ * The pass works on the parsed levels before they are assembled. A configuration load in a
+ * loop body is moved in front of the loop, if
+ * - its address and line operands are constants or variables which are not changed in the loop,
+ * - no other load of the same configuration cache in the loop may use the same line,
+ * - the loop does not store to shared memory (STORED, STOREDA), which could change the bitstream,
+ * - no START and no line select of the same configuration cache (SLCT_PECC_LINE, SLCT_CHCC_LINE)
+ *   is located in front of the load in the loop body.
+ * Loops are processed from inside out, thus loads can be hoisted over several loop levels.
+ * Because loop bodies run at least once, the hoisted load is executed on every path.
+ */
+class ConfigHoisting : public ILevelPass
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] isaA Instruction set to identify configuration loads.
+     */
+    ConfigHoisting(const InstructionSet &isaA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~ConfigHoisting(void) = default;
+
+    virtual std::string getName(void) const override final;
+
+    /**
+     * @brief Hoist configuration loads in all loops of a level.
+     *
+     * @param[in,out] levelA Top level of parsed assembler file.
+     * @return Number of hoisted configuration loads.
+     */
+    virtual uint64_t run(Level *const levelA) override final;
+
+    /**
+     * @brief Get number of configuration transfers saved by hoisting.
+     *
+     * @details
+     * Valid after the levels are assembled, because loop iterations are counted by Loop::assemble.
+     */
+    uint64_t getSavedTransfers(void) const;
+
+    /**
+     * @brief Write hoisted loads and saved configuration transfers.
+     *
+     * @param[out] osA Output stream to write report to.
+     */
+    virtual void report(std::ostream &osA) const override final;
+
+  private:
+    /**
+     * @brief Hoisted configuration load.
+     */
+    struct Hoist
+    {
+        const ParseObjBase *load; //!< @brief Configuration load
+        const Loop *innermost;    //!< @brief Loop where the load was located in the assembler file
+        const Loop *outermost;    //!< @brief Outermost loop the load was hoisted out of
+    };
+
+    /**
+     * @brief Properties of a level including its child levels.
+     */
+    struct Summary
+    {
+        std::vector<const ParseObjBase *> modified;             //!< @brief Variables changed by arithmetic or VAR
+        std::array<std::vector<const ParseObjBase *>, 2> loads; //!< @brief Loads of PC and CC
+        std::array<bool, 2> selects;                            //!< @brief PECC and CHCC line selects
+        bool start;                                             //!< @brief Level contains START
+        bool stores;                                            //!< @brief Level contains stores to shared memory
+    };
+
+    /**
+     * @brief Hoist loads of child loops into a level, inner loops first.
+     */
+    void hoistIn(Level *const levelA);
+
+    /**
+     * @brief Remove hoistable loads from a loop body.
+     *
+     * @return Removed loads in order of the loop body.
+     */
+    std::vector<ParseObjBase *> hoistOutOf(Loop *const loopA);
+
+    /**
+     * @brief Collect properties of a level and its child levels.
+     */
+    void summarize(const Level *const levelA, Summary &sumA) const;
+
+    /**
+     * @brief Check that an operand does not change in a summarized level.
+     */
+    bool isInvariant(const ParseObjBase *const opA, const Summary &sumA) const;
+
+    /**
+     * @brief Get index of configuration cache (0=PC, 1=CC) of a load or select, or SIZE_MAX.
+     */
+    std::size_t getCache(const ParseObjBase *const poA, const std::array<uint32_t, 2> &idsA) const;
+
+    // Member
+    std::array<uint32_t, 2> m_loadIds;
+    //!< @brief Machine code IDs of LOADPC and LOADCC.
+    std::array<uint32_t, 2> m_selectIds;
+    //!< @brief Machine code IDs of SLCT_PECC_LINE and SLCT_CHCC_LINE.
+    uint32_t m_start, m_stored, m_storeda;
+    //!< @brief Machine code IDs of START, STORED and STOREDA.
+    std::vector<Hoist> m_hoisted;
+    //!< @brief Hoisted loads of last run.
+};
+
+} /* End namespace as */
+
+#endif // CONFIGHOISTING_H
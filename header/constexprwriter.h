@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef CONSTEXPRWRITER_H
+#define CONSTEXPRWRITER_H
+
+#include "ioutputwriter.h"
+
+namespace as
+{
+
+/**
+ * @class ConstexprWriter
+ *
+ * @brief Write machine code as constexpr array of raw integer words in a single header file.
+ *
+ * @details
+ * The words are stored as integer literals (output format "constexpr"), thus the
+ * program is usable at compile time and no string conversion is necessary at runtime.
+ * The word type is std::uint32_t if all words fit into 32 bit and std::uint64_t otherwise.
+ */
+class ConstexprWriter : public IOutputWriter
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    ConstexprWriter(const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~ConstexprWriter(void) = default;
+
+    /**
+     * @brief Write machine code of an instruction stream to the output header.
+     *
+     * @throws AssemblerException if the output file cannot be opened.
+     *
+     * @param[in] streamA Assembled instruction stream.
+     * @param[in] outPathA Path to output header file.
+     * @return List with path of written header file.
+     */
+    virtual std::vector<boost::filesystem::path> write(const InstructionStream &streamA,
+                                                       const boost::filesystem::path &outPathA) override;
+};
+
+} /* End namespace as */
+
+#endif // CONSTEXPRWRITER_H
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DEADCODEELIMINATION_H
+#define DEADCODEELIMINATION_H
+
+#include "ilevelpass.h"
+#include <cstdint>
+#include <iostream>
+#include <unordered_set>
+#include <vector>
+
+namespace as
+{
+
+// Forward declarations
+class Loop;
+class ParseObjBase;
+
+/**
+ * @class DeadCodeElimination
+ *
+ * @brief Remove arithmetic operations and variable resets which do not change the machine code.
+ *
+ * @details
+ * The pass works on the parsed levels before they are assembled:
+ * - Constant propagation: A variable is constant, if it is not the target of an arithmetic
+ *   operation and all its resets (VAR) assign its initial value from a constant or another
+ *   constant variable. These resets are removed.
+ * - Identity operations (ADD/ADDI/SUB/SUBI with 0, MUL/MULI with 1) are removed.
+ * - Liveness: A variable is live, if it is an operand of a VCGRA command or a loop range, or
+ *   if it is an operand of an operation or reset of a live variable. Operations and resets of
+ *   variables which are not live are removed.
+ */
+class DeadCodeElimination : public ILevelPass
+{
+  public:
+    /**
+     * @brief Empty constructor
+     */
+    DeadCodeElimination(void) = default;
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~DeadCodeElimination(void) = default;
+
+    virtual std::string getName(void) const override final;
+
+    /**
+     * @brief Remove dead operations and resets in a level and all its child levels.
+     *
+     * @param[in,out] levelA Top level of parsed assembler file.
+     * @return Number of removed parse objects.
+     */
+    virtual uint64_t run(Level *const levelA) override final;
+
+    /**
+     * @brief Write number of removed parse objects per reason.
+     *
+     * @param[out] osA Output stream to write report to.
+     */
+    virtual void report(std::ostream &osA) const override final;
+
+  private:
+    /**
+     * @brief Collect parse objects of a level and its child levels.
+     */
+    void collect(Level *const levelA);
+
+    /**
+     * @brief Get constant value of an operand.
+     *
+     * @param[in] opA Operand (constant or variable).
+     * @param[out] valueA Value of operand, if it is constant.
+     * @return True if the operand has a constant value.
+     */
+    bool getConstant(const ParseObjBase *const opA, int32_t &valueA) const;
+
+    /**
+     * @brief Remove marked parse objects from a level and its child levels.
+     */
+    void remove(Level *const levelA);
+
+    // Member
+    std::vector<ParseObjBase *> m_objects;
+    //!< @brief Parse objects of all levels.
+    std::vector<const Loop *> m_loops;
+    //!< @brief Loops of all levels.
+    std::unordered_set<const ParseObjBase *> m_modified;
+    //!< @brief Variables which are changed while assembling.
+    std::unordered_set<const ParseObjBase *> m_dead;
+    //!< @brief Parse objects to remove.
+    uint64_t m_constResets{0}, m_identities{0}, m_unused{0};
+    //!< @brief Removed resets of constant variables, identity operations and unused operations of last run.
+};
+
+} /* End namespace as */
+
+#endif // DEADCODEELIMINATION_H
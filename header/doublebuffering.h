@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef DOUBLEBUFFERING_H
+#define DOUBLEBUFFERING_H
+
+#include "instructionset.h"
+#include "ipass.h"
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @class DoubleBuffering
+ *
+ * @brief Software pipeline tiles of loads, computation and stores with alternating cache lines.
+ *
+ * @details
+ * A tile is a sequence of line selects and loads (LOADD, LOADDA) into the selected data input
+ * cache (DIC) line, followed by START, WAIT_READY and stores (STORED, STOREDA) from the selected
+ * data output cache (DOC) line. For a run of consecutive tiles the loads of the next tile are moved
+ * in front of the WAIT_READY of the current tile, so data movement overlaps the computation:
+ *
+ *     loads(0) START(0) loads(1) WAIT_READY(0) stores(0) START(1) loads(2) WAIT_READY(1) ...
+ *
+ * If consecutive tiles also use different DOC lines, the stores of a tile are delayed behind the
+ * START of the next tile. Tiles which always use the same line are renamed to alternate between
+ * the original and an unused line ("Num_Dic_Lines", "Num_Doc_Lines"), if the original line is not
+ * loaded outside the tiles and all tiles load the same places. The last tile keeps its lines, thus
+ * the cache contents behind the tiles are unchanged. Tiles are not pipelined where the loads of a
+ * tile read shared memory which is written by the stores of its predecessor.
+ */
+class DoubleBuffering : public IPass
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] isaA Instruction set to decode machine code words.
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    DoubleBuffering(const InstructionSet &isaA, const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~DoubleBuffering(void) = default;
+
+    virtual std::string getName(void) const override final;
+
+    virtual uint64_t run(InstructionStream &streamA) override final;
+
+    virtual void report(std::ostream &osA) const override final;
+
+  private:
+    /**
+     * @brief Currently selected data cache lines (UINT32_MAX if unknown).
+     */
+    struct Selection
+    {
+        uint32_t dic; //!< @brief Selected data input cache line
+        uint32_t doc; //!< @brief Selected data output cache line
+    };
+
+    /**
+     * @brief Stream positions of the instructions of a tile.
+     */
+    struct Tile
+    {
+        uint64_t begin;               //!< @brief Position of first instruction
+        uint64_t end;                 //!< @brief Position behind last instruction
+        std::vector<uint64_t> pre;    //!< @brief Configuration cache line selects before START
+        std::vector<uint64_t> loads;  //!< @brief Loads into data input cache
+        std::vector<uint64_t> stores; //!< @brief Stores from data output cache
+        uint64_t start;               //!< @brief Position of START
+        uint64_t wait;                //!< @brief Position of WAIT_READY
+        uint32_t dic;                 //!< @brief Selected data input cache line at START
+        uint32_t doc;                 //!< @brief Selected data output cache line at START
+    };
+
+    /**
+     * @brief Pipelining properties of a run of tiles.
+     */
+    struct Schedule
+    {
+        bool renameDic;  //!< @brief Rename data input cache line of every second tile
+        uint32_t altDic; //!< @brief Alternative data input cache line
+        bool renameDoc;  //!< @brief Rename data output cache line of every second tile
+        uint32_t altDoc; //!< @brief Alternative data output cache line
+        bool delay;      //!< @brief Delay stores of a tile behind START of next tile
+    };
+
+    /**
+     * @brief Parse a tile starting at a stream position.
+     *
+     * @param[in] instsA Instructions of stream.
+     * @param[in] idxA Position of first instruction of tile.
+     * @param[in,out] selA Selected lines before the tile, updated to selected lines behind the tile.
+     * @param[out] tileA Parsed tile.
+     * @return False if there is no tile at idxA. selA is not modified in this case.
+     */
+    bool parseTile(const std::vector<Instruction> &instsA, const uint64_t idxA, Selection &selA, Tile &tileA) const;
+
+    /**
+     * @brief Update selected lines by an instruction.
+     */
+    void updateSelection(const Instruction &instA, Selection &selA) const;
+
+    /**
+     * @brief Check that loads of a tile read shared memory which is written by stores of another tile.
+     */
+    bool conflicts(const std::vector<Instruction> &instsA, const Tile &storeTileA, const Tile &loadTileA) const;
+
+    /**
+     * @brief Get shared memory range [first, second) of a load or store.
+     */
+    std::pair<uint64_t, uint64_t> getRange(const uint64_t wordA) const;
+
+    /**
+     * @brief Decide how a run of tiles is pipelined.
+     *
+     * @param[in] instsA Instructions of stream.
+     * @param[in] tilesA Run of consecutive tiles.
+     * @param[out] scheduleA Pipelining properties.
+     * @return False if the run cannot be pipelined.
+     */
+    bool plan(const std::vector<Instruction> &instsA, const std::vector<Tile> &tilesA, Schedule &scheduleA) const;
+
+    /**
+     * @brief Append pipelined instructions of a run of tiles.
+     *
+     * @param[in,out] streamA Stream which owns synthesized parse objects.
+     * @param[in] instsA Instructions of stream.
+     * @param[in] tilesA Run of consecutive tiles.
+     * @param[in] scheduleA Pipelining properties.
+     * @param[out] outA Vector to append instructions to.
+     */
+    void emit(InstructionStream &streamA, const std::vector<Instruction> &instsA, const std::vector<Tile> &tilesA,
+              const Schedule &scheduleA, std::vector<Instruction> &outA) const;
+
+    /**
+     * @brief Copy an instruction with another cache line.
+     */
+    Instruction relocate(InstructionStream &streamA, const Instruction &instA, const uint32_t lineA) const;
+
+    /**
+     * @brief Create a line select command.
+     */
+    Instruction select(InstructionStream &streamA, const Instruction &originA, const uint32_t machineIdA,
+                       const uint32_t lineA) const;
+
+    // Member
+    const InstructionSet &m_isa;
+    //!< @brief Instruction set to decode machine code words.
+    uint32_t m_slctDic, m_slctDoc, m_slctPecc, m_slctChcc;
+    //!< @brief Machine code IDs of line select commands.
+    uint32_t m_loadd, m_loadda, m_stored, m_storeda;
+    //!< @brief Machine code IDs of data cache loads and stores.
+    uint32_t m_start, m_wait;
+    //!< @brief Machine code IDs of START and WAIT_READY.
+    uint32_t m_numDicLines, m_numDicPlaces, m_numDocLines, m_numDocPlaces;
+    //!< @brief Data cache dimensions.
+    uint64_t m_dicStride, m_docStride;
+    //!< @brief Shared memory address distance of neighbouring cache places.
+    std::vector<uint64_t> m_dicLoads, m_dicRefs, m_docRefs;
+    //!< @brief Loads and references (loads, stores, selects) of data cache lines in the stream.
+    uint64_t m_runs, m_tiles;
+    //!< @brief Number of pipelined runs and tiles of last pass execution.
+};
+
+} /* End namespace as */
+
+#endif // DOUBLEBUFFERING_H
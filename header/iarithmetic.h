@@ -54,7 +54,7 @@ class IArithmetic : public ParseObjBase
      * @param[in] secondA Ptr. to second element of arithmetic operation.
      */
 
-    IArithmetic(Level *lvlA, const std::string &cmdLineA, const uint32_t &lineNumberA, ParseObjBase *const firstA,
+    IArithmetic(Level *lvlA, const std::string &cmdLineA, const uint64_t &lineNumberA, ParseObjBase *const firstA,
                 ParseObjBase *const secondA);
     /**
      * @brief Copy constructor
@@ -20,6 +20,7 @@
 
 #include <boost/format.hpp>
 #include <boost/property_tree/ptree.hpp>
+#include <cstdint>
 #include <string>
 
 namespace as
@@ -42,6 +43,19 @@ class IAssemble
      */
     virtual std::string assemble(const boost::property_tree::ptree &ptreeA) = 0;
 
+    /**
+     * @brief Interface function to encode the command as a numeric machine code word.
+     *
+     * @details
+     * The upper part of the word (starting at bit 16) holds the shared memory address,
+     * the lower 16 bit hold cache line, place and machine code ID.
+     *
+     * @param ptreeA Assembler object containing VCGRA configuration parameter
+     *
+     * @return VCGRA machine code word.
+     */
+    virtual uint64_t encode(const boost::property_tree::ptree &ptreeA) = 0;
+
     /**
      * @brief Get ID for machine code of VCGRA command parser.
      *
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef ILEVELPASS_H
+#define ILEVELPASS_H
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace as
+{
+
+// Forward declaration
+class Level;
+
+/**
+ * @interface ILevelPass
+ *
+ * @brief Interface for optimization passes over the parsed levels.
+ *
+ * @details
+ * A level pass transforms the parse objects of the top level and its loops
+ * before they are unrolled into the instruction stream.
+ */
+class ILevelPass
+{
+  public:
+    /**
+     * @brief Destructor
+     */
+    virtual ~ILevelPass(void) = default;
+
+    /**
+     * @brief Get name of pass for reports.
+     */
+    virtual std::string getName(void) const = 0;
+
+    /**
+     * @brief Run pass on parsed levels.
+     *
+     * @param[in,out] levelA Top level of parsed assembler file.
+     * @return Number of applied changes.
+     */
+    virtual uint64_t run(Level *const levelA) = 0;
+
+    /**
+     * @brief Write detailed report of last run (optional).
+     *
+     * @details
+     * The report is written after the levels are assembled.
+     *
+     * @param[out] osA Output stream to write report to.
+     */
+    virtual void report(std::ostream &) const
+    {
+        return;
+    }
+};
+
+} /* End namespace as */
+
+#endif // ILEVELPASS_H
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INSTRUCTIONSET_H
+#define INSTRUCTIONSET_H
+
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace as
+{
+
+/**
+ * @class InstructionSet
+ *
+ * @brief Decode and encode machine code words of the configured VCGRA instruction set.
+ *
+ * @details
+ * The instruction set is created from the "Assembler_Property" section of the program
+ * configuration file. A machine code word consists of the shared memory address
+ * (starting at bit 16), the cache line, the place and the machine code ID:
+ *
+ *     | address | line | place (PlaceSize) | machine code ID (OpCodeSize) |
+ */
+class InstructionSet
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @throws AssemblerException if the assembler properties are missing in the configuration.
+     *
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    InstructionSet(const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~InstructionSet(void) = default;
+
+    /**
+     * @brief Get machine code ID of an operator.
+     *
+     * @param[in] nameA Name of operator (e.g. SLCT_DIC_LINE).
+     * @return Machine code ID or UINT32_MAX if the operator is not available.
+     */
+    uint32_t getMachineId(const std::string &nameA) const;
+
+    /**
+     * @brief Get name of an operator.
+     *
+     * @param[in] machineIdA Machine code ID of operator.
+     * @return Name of operator or empty string if the machine code ID is unknown.
+     */
+    std::string getName(const uint32_t machineIdA) const;
+
+    /**
+     * @brief Get number of operands of an operator.
+     *
+     * @param[in] machineIdA Machine code ID of operator.
+     * @return Number of operands or UINT32_MAX if the machine code ID is unknown.
+     */
+    uint32_t getNumOperands(const uint32_t machineIdA) const;
+
+    /** @brief Get number of bits of machine code ID. */
+    uint32_t getOpCodeSize(void) const;
+
+    /** @brief Get machine code ID of a machine code word. */
+    uint32_t getMachineCode(const uint64_t wordA) const;
+
+    /** @brief Get place of a machine code word. */
+    uint32_t getPlace(const uint64_t wordA) const;
+
+    /** @brief Get cache line of a machine code word. */
+    uint32_t getLine(const uint64_t wordA) const;
+
+    /** @brief Get shared memory address of a machine code word. */
+    uint64_t getAddress(const uint64_t wordA) const;
+
+    /**
+     * @brief Create a machine code word.
+     *
+     * @param[in] machineIdA Machine code ID.
+     * @param[in] addressA Shared memory address.
+     * @param[in] lineA Cache line.
+     * @param[in] placeA Place in cache line.
+     * @return Machine code word.
+     */
+    uint64_t encode(const uint32_t machineIdA, const uint64_t addressA, const uint32_t lineA,
+                    const uint32_t placeA) const;
+
+    /**
+     * @brief Create a machine code word of a command on a whole cache line (like TwoOperand).
+     *
+     * @param[in] machineIdA Machine code ID.
+     * @param[in] addressA Shared memory address.
+     * @param[in] lineA Cache line.
+     * @return Machine code word.
+     */
+    uint64_t encodeLine(const uint32_t machineIdA, const uint64_t addressA, const uint32_t lineA) const;
+
+  private:
+    // Member
+    uint32_t m_opCodeSize;
+    //!< @brief Number of bits of machine code ID.
+    uint32_t m_placeSize;
+    //!< @brief Number of bits of place.
+    std::unordered_map<std::string, uint32_t> m_machineIds;
+    //!< @brief Machine code IDs of available operators by name.
+    std::unordered_map<uint32_t, std::pair<std::string, uint32_t>> m_operators;
+    //!< @brief Name and number of operands of available operators by machine code ID.
+};
+
+} /* End namespace as */
+
+#endif // INSTRUCTIONSET_H
@@ -0,0 +1,166 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INSTRUCTIONSTREAM_H
+#define INSTRUCTIONSTREAM_H
+
+#include "parseobjbase.h"
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace as
+{
+
+// Forward declarations
+class Loop;
+
+/**
+ * @struct Instruction
+ *
+ * @brief Single machine code word of an assembled program.
+ */
+struct Instruction
+{
+    uint64_t word;              //!< @brief Encoded machine code word
+    const ParseObjBase *source; //!< @brief Parse object which emitted the machine code word
+    const Loop *loop;           //!< @brief Innermost loop which emitted the word (nullptr for top level)
+};
+
+/**
+ * @class InstructionStream
+ *
+ * @brief Sequence of machine code words of an assembled program.
+ *
+ * @details
+ * The assembler unrolls all loops of the parsed levels into an instruction stream.
+ * Output writers create the output files from the stream. Every instruction keeps a
+ * handle to its parse object to provide the assembler source line for comments.
+ */
+class InstructionStream
+{
+  public:
+    typedef std::vector<Instruction>::iterator iterator;
+    //!< @brief Iterator over instructions of stream.
+    typedef std::vector<Instruction>::const_iterator const_iterator;
+    //!< @brief Constant iterator over instructions of stream.
+
+    /**
+     * @brief Empty constructor
+     */
+    InstructionStream() = default;
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~InstructionStream() = default;
+
+    /**
+     * @brief Append a machine code word to the end of the stream.
+     *
+     * @param wordA Encoded machine code word.
+     * @param sourceA Parse object which emitted the word.
+     * @param loopA Innermost loop which emitted the word (nullptr for top level).
+     */
+    void append(const uint64_t wordA, const ParseObjBase *sourceA, const Loop *loopA);
+
+    /**
+     * @brief Create a parse object for an instruction which is synthesized by an optimization pass.
+     *
+     * @details
+     * The parse object is owned by the stream and provides the assembler line comment
+     * of the synthesized instruction. Level and file line are taken from the origin.
+     *
+     * @param originA Parse object of the replaced instruction.
+     * @param cmdA Command class of the synthesized instruction.
+     * @param cmdLineA Assembler line of the synthesized instruction.
+     * @return Pointer to new parse object, valid until the stream is cleared.
+     */
+    const ParseObjBase *synthesize(const ParseObjBase &originA, const COMMANDCLASS cmdA, const std::string &cmdLineA);
+
+    /**
+     * @brief Remove all instructions from stream.
+     */
+    void clear(void);
+
+    /**
+     * @brief Return number of instructions in stream.
+     */
+    uint64_t size(void) const;
+
+    /**
+     * @brief Return true, if stream contains no instruction.
+     */
+    bool empty(void) const;
+
+    /**
+     * @brief Get access to instruction at position idxA.
+     *
+     * @throws std::out_of_range if idxA exceeds the stream.
+     *
+     * @param[in] idxA Position of instruction in stream.
+     */
+    const Instruction &at(uint64_t idxA) const;
+
+    /**
+     * @brief Get access to vector of instructions.
+     *
+     * @return Reference to instruction vector of stream.
+     */
+    std::vector<Instruction> &getInstructions(void);
+
+    /**
+     * @brief Get constant access to vector of instructions.
+     *
+     * @return Constant reference to instruction vector of stream.
+     */
+    const std::vector<Instruction> &getInstructions(void) const;
+
+    /**
+     * @brief Return iterator over instructions
+     */
+    iterator begin();
+    /**
+     * @brief Return iterator over instructions
+     */
+    iterator end();
+
+    /**
+     * @brief Return iterator over instructions
+     */
+    const_iterator cbegin() const;
+    /**
+     * @brief Return iterator over instructions
+     */
+    const_iterator cend() const;
+
+  private:
+    // Forbidden constructors
+    InstructionStream(const InstructionStream &src) = delete;
+    InstructionStream &operator=(const InstructionStream &src) = delete;
+
+    // Class members
+    std::vector<Instruction> m_instructions{};
+    //!< @brief Assembled machine code words in program order.
+    std::vector<std::unique_ptr<ParseObjBase>> m_synthesized{};
+    //!< @brief Parse objects of instructions synthesized by optimization passes.
+};
+
+} /* End namespace as */
+
+#endif // INSTRUCTIONSTREAM_H
@@ -0,0 +1,222 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef INSTRUMENTATION_H
+#define INSTRUMENTATION_H
+
+#include "parseobjbase.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @class Instrumentation
+ *
+ * @brief Phase timers and event counters of an assembler run.
+ *
+ * @details
+ * Timers and counters are recorded into the active instrumentation, which is set by
+ * setCurrent. Without an active instrumentation all recording functions return
+ * immediately, thus the instrumentation points stay in the code permanently. Phases
+ * are kept in order of their first occurrence and may nest (e.g. "lowering" is part
+ * of "assemble"). The report is written as text or as JSON for automated tracking.
+ */
+class Instrumentation
+{
+  public:
+    /**
+     * @brief Event counters of an assembler run.
+     */
+    enum class COUNTER : uint8_t
+    {
+        LINES,           //!< @brief Parsed lines of assembler file
+        SYMBOL_LOOKUPS,  //!< @brief Searches for constants and variables in levels
+        LOOP_ITERATIONS, //!< @brief Unrolled loop iterations
+        WORDS_UNROLLED,  //!< @brief Machine code words after unrolling
+        WORDS_EMITTED,   //!< @brief Machine code words written to output
+        NUM_COUNTERS     //!< @brief Number of counters (no counter)
+    };
+
+    /**
+     * @class Timer
+     *
+     * @brief Measure the run time of a scope as a phase of the active instrumentation.
+     */
+    class Timer
+    {
+      public:
+        /**
+         * @brief Start phase measurement.
+         *
+         * @param[in] phaseA Name of phase.
+         */
+        explicit Timer(const std::string &phaseA);
+
+        /**
+         * @brief Stop measurement and record the phase.
+         */
+        ~Timer(void);
+
+      private:
+        // Forbidden constructors
+        Timer(const Timer &src) = delete;
+        Timer &operator=(const Timer &src) = delete;
+
+        // Member
+        std::string m_phase;
+        //!< @brief Name of phase.
+        std::chrono::steady_clock::time_point m_begin;
+        //!< @brief Start time of phase.
+    };
+
+    /**
+     * @brief Empty constructor
+     */
+    Instrumentation(void);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~Instrumentation(void);
+
+    /**
+     * @brief Set active instrumentation of the calling thread.
+     *
+     * @param[in] instA Instrumentation to record into (nullptr disables recording).
+     */
+    static void setCurrent(Instrumentation *instA);
+
+    /**
+     * @brief Get active instrumentation (nullptr, if recording is disabled).
+     */
+    static Instrumentation *getCurrent(void);
+
+    /**
+     * @brief Add valueA to a counter of the active instrumentation.
+     *
+     * @param[in] counterA Counter to increment.
+     * @param[in] valueA Value to add.
+     */
+    static inline void count(const COUNTER counterA, const uint64_t valueA = 1)
+    {
+        if (current)
+            current->m_counters[static_cast<uint8_t>(counterA)] += valueA;
+    }
+
+    /**
+     * @brief Count an allocated parse object of the active instrumentation.
+     *
+     * @param[in] classA Command class of parse object.
+     */
+    static inline void countObject(const COMMANDCLASS classA)
+    {
+        if (current)
+            ++current->m_objects[static_cast<uint8_t>(classA)];
+    }
+
+    /**
+     * @brief Add run time of a phase to the active instrumentation.
+     *
+     * @param[in] phaseA Name of phase.
+     * @param[in] millisecondsA Run time of phase.
+     */
+    static void record(const std::string &phaseA, const double millisecondsA);
+
+    /**
+     * @brief Add phases and counters of another instrumentation (e.g. of a worker thread).
+     *
+     * @details
+     * Run times of phases are summed, thus phases measured in concurrent threads may
+     * exceed the wall time.
+     *
+     * @param[in] otherA Instrumentation to add.
+     */
+    void merge(const Instrumentation &otherA);
+
+    /**
+     * @brief Get value of a counter.
+     */
+    uint64_t getCounter(const COUNTER counterA) const;
+
+    /**
+     * @brief Get accumulated run time of a phase (0, if the phase was never recorded).
+     */
+    double getMilliseconds(const std::string &phaseA) const;
+
+    /**
+     * @brief Write phase timers and counters.
+     *
+     * @throws AssemblerException if the format is unknown.
+     *
+     * @param[out] osA Output stream to write report to.
+     * @param[in] formatA Report format ("text" or "json").
+     */
+    void report(std::ostream &osA, const std::string &formatA) const;
+
+    /**
+     * @brief Check if formatA is a known report format.
+     */
+    static bool isFormat(const std::string &formatA);
+
+  private:
+    /**
+     * @brief Accumulated measurements of a phase.
+     */
+    struct Phase
+    {
+        std::string name;    //!< @brief Name of phase
+        uint64_t calls;      //!< @brief Number of measurements
+        double milliseconds; //!< @brief Accumulated run time
+    };
+
+    /**
+     * @brief Write report as text.
+     */
+    void writeText(std::ostream &osA) const;
+
+    /**
+     * @brief Write report as JSON object.
+     */
+    void writeJson(std::ostream &osA) const;
+
+    // Forbidden constructors
+    Instrumentation(const Instrumentation &src) = delete;
+    Instrumentation &operator=(const Instrumentation &src) = delete;
+
+    // Member
+    std::vector<Phase> m_phases;
+    //!< @brief Measured phases in order of first occurrence.
+    std::array<uint64_t, static_cast<uint8_t>(COUNTER::NUM_COUNTERS)> m_counters;
+    //!< @brief Event counters.
+    std::array<uint64_t, static_cast<uint8_t>(COMMANDCLASS::RESETVAR) + 1> m_objects;
+    //!< @brief Allocated parse objects per command class.
+
+    // Class static members
+    static thread_local Instrumentation *current;
+    //!< @brief Active instrumentation of thread (nullptr, if recording is disabled).
+};
+
+} /* End namespace as */
+
+#endif // INSTRUMENTATION_H
@@ -0,0 +1,119 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef IOUTPUTWRITER_H
+#define IOUTPUTWRITER_H
+
+#include "instructionstream.h"
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @interface IOutputWriter
+ *
+ * @brief Interface for writers of the assembled machine code.
+ *
+ * @details
+ * An output writer formats an instruction stream and stores it in one
+ * or more files. The optional configuration parameter "General.Include"
+ * names a header which is included by the created files to provide the
+ * type cgra::TopLevel::assembler_type_t. The parameter "General.Comments"
+ * (default=true) enables the assembler source line comment of each word.
+ */
+class IOutputWriter
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    IOutputWriter(const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~IOutputWriter(void) = default;
+
+    /**
+     * @brief Write machine code of an instruction stream to output files.
+     *
+     * @throws AssemblerException if an output file cannot be opened.
+     *
+     * @param[in] streamA Assembled instruction stream.
+     * @param[in] outPathA Path to output header file from configuration file.
+     * @return List of written files.
+     */
+    virtual std::vector<boost::filesystem::path> write(const InstructionStream &streamA,
+                                                       const boost::filesystem::path &outPathA) = 0;
+
+  protected:
+    /**
+     * @brief Format machine code word like the string representation of IAssemble::assemble.
+     *
+     * @param[in] wordA Machine code word.
+     * @return Hexadecimal string of word without quotes.
+     */
+    static std::string toHexString(const uint64_t wordA);
+
+    /**
+     * @brief Get include guard name for an output file.
+     *
+     * @param[in] pathA Path to output file.
+     */
+    static std::string getGuardName(const boost::filesystem::path &pathA);
+
+    /**
+     * @brief Write include directive of configured type header, if any.
+     *
+     * @param[out] osA Output stream to write to.
+     */
+    void writeInclude(std::ostream &osA) const;
+
+    /**
+     * @brief Write one instruction as a quoted string initializer with source line comment.
+     *
+     * @param[out] osA Output stream to write to.
+     * @param[in] instA Instruction to write.
+     */
+    void writeStringWord(std::ostream &osA, const Instruction &instA) const;
+
+    /**
+     * @brief Finish initializer line with source line comment, if comments are enabled.
+     *
+     * @param[out] osA Output stream to write to.
+     * @param[in] instA Instruction of initializer line.
+     */
+    void writeComment(std::ostream &osA, const Instruction &instA) const;
+
+    // Member
+    std::string m_include;
+    //!< @brief Header file to include for the type definition of machine code words (optional).
+    bool m_comments;
+    //!< @brief Add assembler source line as comment to each machine code word.
+};
+
+} /* End namespace as */
+
+#endif // IOUTPUTWRITER_H
@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef IPASS_H
+#define IPASS_H
+
+#include "instructionstream.h"
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+namespace as
+{
+
+/**
+ * @interface IPass
+ *
+ * @brief Interface for optimization passes over an assembled instruction stream.
+ *
+ * @details
+ * A pass transforms the unrolled instruction stream of the assembler before it is
+ * stored by an output writer. Passes have to keep the behavior of the VCGRA program.
+ */
+class IPass
+{
+  public:
+    /**
+     * @brief Destructor
+     */
+    virtual ~IPass(void) = default;
+
+    /**
+     * @brief Get name of pass for reports.
+     */
+    virtual std::string getName(void) const = 0;
+
+    /**
+     * @brief Run pass on an instruction stream.
+     *
+     * @param[in,out] streamA Instruction stream to transform.
+     * @return Number of applied changes (e.g. removed instructions).
+     */
+    virtual uint64_t run(InstructionStream &streamA) = 0;
+
+    /**
+     * @brief Write detailed report of last run (optional).
+     *
+     * @param[out] osA Output stream to write report to.
+     */
+    virtual void report(std::ostream &) const
+    {
+        return;
+    }
+};
+
+} /* End namespace as */
+
+#endif // IPASS_H
@@ -0,0 +1,192 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef KERNELGENERATOR_H
+#define KERNELGENERATOR_H
+
+#include <array>
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @class KernelGenerator
+ *
+ * @brief Generate valid synthetic assembler programs for benchmarks and scaling tests.
+ *
+ * @details
+ * A program consists of constant and variable definitions followed by a body of
+ * commands. Each body contains nested loops up to the nesting depth. The commands are
+ * drawn from a weighted mix of command classes. The generator tracks the values of all
+ * variables, thus memory addresses stay in range of "VCGRA_Property.Available_Memory"
+ * and line and place operands are in range of the cache sizes of the configuration.
+ * Every loop body redefines all variables first and completes a started computation
+ * before it ends, so that all iterations behave the same. Commands which would change a
+ * cache line or line selection used by a running computation complete the computation
+ * first, thus the programs are free of hazards. The same parameters and seed create the
+ * same program on every platform.
+ */
+class KernelGenerator
+{
+  public:
+    /**
+     * @brief Command classes of the weighted mix.
+     */
+    enum class MIX : uint8_t
+    {
+        NOOPERAND,    //!< @brief NOOP, START, WAIT_READY
+        ONEOPERAND,   //!< @brief Line selects
+        TWOOPERAND,   //!< @brief LOADDA, STOREDA, LOADPC, LOADCC
+        THREEOPERAND, //!< @brief LOADD, STORED
+        ARITHMETIC,   //!< @brief ADD, ADDI, SUB, SUBI, MUL, MULI
+        RESETVAR,     //!< @brief Redefinition of a variable
+        NUM_MIX       //!< @brief Number of command classes (no class)
+    };
+
+    /**
+     * @brief Parameters of a generated program.
+     */
+    struct Parameters
+    {
+        uint64_t seed{1};      //!< @brief Seed of random number generator
+        uint32_t depth{2};     //!< @brief Nesting depth of loops
+        uint32_t trips{8};     //!< @brief Iterations per loop
+        uint32_t body{16};     //!< @brief Commands per loop body (without nested loops)
+        uint32_t loops{1};     //!< @brief Nested loops per loop body
+        uint32_t symbols{8};   //!< @brief Number of constants
+        uint32_t variables{4}; //!< @brief Number of variables
+        std::array<uint32_t, static_cast<uint8_t>(MIX::NUM_MIX)> mix{{1, 2, 1, 4, 3, 1}};
+        //!< @brief Weights of command classes in order of MIX.
+    };
+
+    /**
+     * @brief General constructor
+     *
+     * @throws AssemblerException if a required parameter is missing in the configuration.
+     *
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    KernelGenerator(const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~KernelGenerator(void) = default;
+
+    /**
+     * @brief Write a program.
+     *
+     * @throws AssemblerException if the parameters cannot create a valid program.
+     *
+     * @param[in] paramA Parameters of program.
+     * @param[out] osA Output stream to write program to.
+     */
+    void generate(const Parameters &paramA, std::ostream &osA);
+
+    /**
+     * @brief Get number of lines of last generated program.
+     */
+    uint64_t getLines(void) const;
+
+    /**
+     * @brief Get number of machine code words of last generated program after unrolling.
+     */
+    uint64_t getWords(void) const;
+
+    /**
+     * @brief Parse a comma separated list of mix weights (e.g. "1,2,1,4,3,1").
+     *
+     * @throws AssemblerException if the list is malformed.
+     */
+    static std::array<uint32_t, static_cast<uint8_t>(MIX::NUM_MIX)> parseMix(const std::string &mixA);
+
+  private:
+    /**
+     * @brief Generator state of a loop body.
+     */
+    struct State
+    {
+        std::vector<int64_t> values;      //!< @brief Current values of variables
+        bool running;                     //!< @brief A started computation is not completed
+        std::array<uint32_t, 4> selected; //!< @brief Selected DIC, DOC, PC and CC line (UINT32_MAX = unknown)
+        std::array<uint32_t, 4> busy;     //!< @brief Lines used by running computation (UINT32_MAX = unknown)
+    };
+
+    /**
+     * @brief Write WAIT_READY, if a computation is running and uses line lineA of cache cacheA.
+     *
+     * @param[in] cacheA Index of cache (0 = DIC, 1 = DOC, 2 = PC, 3 = CC) or UINT8_MAX to complete any computation.
+     */
+    void complete(std::ostream &osA, State &stateA, const std::string &indentA, const uint64_t multiplicityA,
+                  const uint8_t cacheA = UINT8_MAX, const uint32_t lineA = 0);
+
+    /**
+     * @brief Write body of nesting depth depthA, which is executed multiplicityA times.
+     */
+    void writeBody(std::ostream &osA, State &stateA, const uint32_t depthA, const uint64_t multiplicityA);
+
+    /**
+     * @brief Write one command of the weighted mix.
+     */
+    void writeCommand(std::ostream &osA, State &stateA, const std::string &indentA, const uint64_t multiplicityA);
+
+    /**
+     * @brief Write arithmetic command, which keeps the variable in range.
+     */
+    void writeArithmetic(std::ostream &osA, State &stateA, const std::string &indentA);
+
+    /**
+     * @brief Get name of a random address symbol (constant or variable).
+     *
+     * @details
+     * Values of all symbols are valid addresses at any time.
+     */
+    std::string getAddress(void);
+
+    /**
+     * @brief Get random number in [0, boundA).
+     */
+    uint64_t random(const uint64_t boundA);
+
+    // Member
+    int64_t m_limit;
+    //!< @brief Maximal address of a data transfer.
+    uint32_t m_dicLines, m_dicPlaces, m_docLines, m_docPlaces, m_pcLines, m_ccLines;
+    //!< @brief Cache sizes of VCGRA.
+    Parameters m_param;
+    //!< @brief Parameters of current program.
+    std::vector<int64_t> m_symbols;
+    //!< @brief Values of constants.
+    std::vector<int64_t> m_initial;
+    //!< @brief Initial values of variables.
+    std::mt19937_64 m_rng;
+    //!< @brief Random number generator (standardized sequence for all platforms).
+    uint64_t m_lines;
+    //!< @brief Lines of generated program.
+    uint64_t m_words;
+    //!< @brief Machine code words of generated program.
+};
+
+} /* End namespace as */
+
+#endif // KERNELGENERATOR_H
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LATENCYMODEL_H
+#define LATENCYMODEL_H
+
+#include "instructionset.h"
+#include "instructionstream.h"
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @class LatencyModel
+ *
+ * @brief Estimate execution cycles of machine code words from per-command latencies.
+ *
+ * @details
+ * Latencies are read from the configuration section "Timing": "Default" (default=1) is used
+ * for commands without an own "Latency" entry (children "Name" and "Cycles"). The controller
+ * executes commands in order and each command occupies it for its latency. START begins a
+ * computation of "Fabric" (default=1) cycles, which runs in parallel to the following commands.
+ * WAIT_READY waits for the end of the computation. If "Bandwidth" (bytes per cycle, default=0
+ * for unlimited) is set, transfers between shared memory and data caches (LOADD, LOADDA,
+ * STORED, STOREDA) additionally take their bytes divided by the bandwidth.
+ */
+class LatencyModel
+{
+  public:
+    /**
+     * @brief Execution state of controller and VCGRA.
+     */
+    struct State
+    {
+        uint64_t cycle;       //!< @brief Cycle when the controller is able to execute the next command
+        uint64_t fabricReady; //!< @brief Cycle when the VCGRA finishes its last computation
+    };
+
+    /**
+     * @brief General constructor
+     *
+     * @param[in] isaA Instruction set to decode machine code words.
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    LatencyModel(const InstructionSet &isaA, const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~LatencyModel(void) = default;
+
+    /**
+     * @brief Get latency of a command.
+     *
+     * @param[in] machineIdA Machine code ID of command.
+     */
+    uint64_t getLatency(const uint32_t machineIdA) const;
+
+    /**
+     * @brief Get duration of a computation of the VCGRA.
+     */
+    uint64_t getFabric(void) const;
+
+    /**
+     * @brief Get cycle when a command can start in an execution state.
+     *
+     * @param[in] stateA Execution state.
+     * @param[in] wordA Machine code word of command.
+     */
+    uint64_t getStart(const State &stateA, const uint64_t wordA) const;
+
+    /**
+     * @brief Execute a command.
+     *
+     * @param[in,out] stateA Execution state to update.
+     * @param[in] wordA Machine code word of command.
+     */
+    void issue(State &stateA, const uint64_t wordA) const;
+
+    /**
+     * @brief Execute a command, whose operands do not matter for the latency.
+     *
+     * @param[in,out] stateA Execution state to update.
+     * @param[in] machineIdA Machine code ID of command.
+     */
+    void issueCommand(State &stateA, const uint32_t machineIdA) const;
+
+    /**
+     * @brief Estimate cycles of an instruction sequence.
+     *
+     * @param[in] instsA Instruction sequence.
+     * @return Cycles until controller and VCGRA are finished.
+     */
+    uint64_t estimate(const std::vector<Instruction> &instsA) const;
+
+  private:
+    // Member
+    std::vector<uint64_t> m_latencies;
+    //!< @brief Latencies per machine code ID.
+    uint64_t m_default;
+    //!< @brief Latency of commands without configured latency.
+    uint64_t m_fabric;
+    //!< @brief Duration of a computation of the VCGRA.
+    uint32_t m_start, m_wait;
+    //!< @brief Machine code IDs of START and WAIT_READY.
+    const InstructionSet &m_isa;
+    //!< @brief Instruction set to decode machine code words.
+};
+
+} /* End namespace as */
+
+#endif // LATENCYMODEL_H
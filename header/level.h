@@ -20,6 +20,7 @@
 
 #include <cstdint>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace as
@@ -37,7 +38,8 @@ class ParseObjBase;
  * A level is used to define visibility of variables and to design control flow.
  * A LOOP for instance opens a new Level and can interact with variables from its
  * parent Level or from itself. A Level includes parse objects and child levels.
- *
+ * Constants and variables of a level are indexed by name, thus a symbol lookup
+ * does not depend on the number of parse objects in the level.
  */
 class Level
 {
@@ -103,7 +105,16 @@ class Level
      * @param[in] idxA idxA: Element index of m_parsedObjVec vector.
      * @return ParseObjBase* nullptr, if element not found or idxA out of range
      */
-    ParseObjBase *getParseObj(uint32_t idxA) const;
+    ParseObjBase *getParseObj(uint64_t idxA) const;
+
+    /**
+     * @brief Insert parse object into m_parsedObjVec.
+     *
+     * @param[in] idxA idxA: Index of m_parsedObjVec where the parse object is inserted.
+     * @param[in] pObjA pObjA: Object pointer of parsed object to insert.
+     * @return uint8_t 0=success, 1=failure.
+     */
+    uint8_t insertParseObj(uint64_t idxA, ParseObjBase *pObjA);
 
     /**
      * @brief Delete parsed object from m_parsedObjVec.
@@ -111,7 +122,7 @@ class Level
      * @param[in] idxA idxA: Index of item in m_parsedObjVec going to be deleted.
      * @return as::ParseObjBase* nullptr if idxA out of range, otherwise pointer to deleted item.
      */
-    ParseObjBase *deleteParseObj(uint32_t idxA);
+    ParseObjBase *deleteParseObj(uint64_t idxA);
 
     /**
      * @brief Find parsed object by name in current level and parent level.
@@ -155,24 +166,15 @@ class Level
     const std::vector<ParseObjBase *> &getParseObjList() const;
 
     /**
-     * @brief Leave current level and set parent level as active level.
-     */
-    void leave(void);
-
-    // Static class methods:
-    /**
-     * @brief Set current active level activeLvl.
+     * @brief Leave level.
      *
-     * @param lvlA lvlA: Pointer to next active level.
-     */
-    static void setCurrentLevel(Level *lvlA);
-
-    /**
-     * @brief Return static class member activeLvl
+     * @details
+     * The active level of a parse is kept by its assembler. Leaving a level makes
+     * its parent level the active level.
      *
-     * @return Level*
+     * @return Parent level (nullptr for the top level).
      */
-    static Level *getCurrentLevel(void);
+    Level *leave(void) const;
 
     /**
      * @brief Return iterator over child levels
@@ -193,7 +195,7 @@ class Level
     std::vector<Level *>::const_iterator cend() const;
 
     /** @brief Get access to child level instance */
-    Level *at(uint32_t lvlId) const;
+    Level *at(uint64_t lvlId) const;
 
     /** @brief Return true, if a parent level exists. */
     bool hasParent() const;
@@ -213,9 +215,8 @@ class Level
     //!< @brief Store parent level
     std::vector<ParseObjBase *> m_parsedObjVec{};
     //!< @brief Store parsed objects of actual level.
-    // Class static members
-    static Level *activeLvl;
-    //!< @brief Currently active level for adding new parsed objects.
+    std::unordered_map<std::string, ParseObjBase *> m_symbolMap{};
+    //!< @brief First constant or variable of each name in m_parsedObjVec.
 };
 
 } /* End namespace as */
@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LINECOALESCING_H
+#define LINECOALESCING_H
+
+#include "instructionset.h"
+#include "ipass.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @class LineCoalescing
+ *
+ * @brief Base class of passes which replace per-place cache commands by one whole-line command.
+ *
+ * @details
+ * A run of per-place commands (e.g. LOADD) on the same cache line is coalesced,
+ * if the run covers each place of the line exactly once and the shared memory address
+ * of place p is base + p * stride. The run is replaced by one line command (e.g. LOADDA)
+ * with address base. The line command takes the position of the first (mergeAtFirstA)
+ * or of the last command of the run. Derived classes define which instructions between
+ * the commands of a run prevent the coalescing.
+ */
+class LineCoalescing : public IPass
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] isaA Instruction set to decode machine code words.
+     * @param[in] placeNameA Name of per-place command (three operands).
+     * @param[in] lineNameA Name of whole-line command (two operands).
+     * @param[in] numPlacesA Number of places of a cache line.
+     * @param[in] strideA Shared memory address distance of neighbouring places.
+     * @param[in] memorySizeA Available shared memory.
+     * @param[in] mergeAtFirstA Place line command at the position of the first (true) or last command of a run.
+     */
+    LineCoalescing(const InstructionSet &isaA, const std::string &placeNameA, const std::string &lineNameA,
+                   const uint32_t numPlacesA, const uint64_t strideA, const uint64_t memorySizeA,
+                   const bool mergeAtFirstA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~LineCoalescing(void) = default;
+
+    virtual uint64_t run(InstructionStream &streamA) override;
+
+  protected:
+    /**
+     * @brief Check that an instruction between the commands of a run prevents the coalescing.
+     *
+     * @param[in] instA Instruction between commands of the run.
+     * @param[in] lineA Cache line of the run.
+     * @param[in] baseA Shared memory address of place 0 of the run.
+     * @return True if the run has to be dropped.
+     */
+    virtual bool isBarrier(const Instruction &instA, const uint32_t lineA, const uint64_t baseA) const = 0;
+
+    /**
+     * @brief Called for each coalesced run.
+     *
+     * @param[in] instA Line command which replaces the run.
+     * @param[in] removedA Number of removed instructions.
+     */
+    virtual void coalesced(const Instruction &instA, const uint64_t removedA);
+
+    // Member
+    const InstructionSet &m_isa;
+    //!< @brief Instruction set to decode machine code words.
+    uint32_t m_placeId;
+    //!< @brief Machine code ID of per-place command.
+    uint32_t m_lineId;
+    //!< @brief Machine code ID of whole-line command.
+    uint32_t m_numPlaces;
+    //!< @brief Number of places of a cache line.
+    uint64_t m_stride;
+    //!< @brief Shared memory address distance of neighbouring places.
+
+  private:
+    /**
+     * @brief Open run of per-place commands on a cache line.
+     */
+    struct Run
+    {
+        std::vector<uint64_t> indices; //!< @brief Stream positions of commands
+        std::vector<bool> places;      //!< @brief Written places of cache line
+        uint64_t base;                 //!< @brief Shared memory address of place 0
+    };
+
+    /**
+     * @brief Add a per-place command to a run.
+     *
+     * @param[in,out] runA Run to extend.
+     * @param[in] idxA Stream position of command.
+     * @param[in] placeA Place of command.
+     * @param[in] addressA Shared memory address of command.
+     * @return False if the command does not continue the run.
+     */
+    bool addToRun(Run &runA, const uint64_t idxA, const uint32_t placeA, const uint64_t addressA) const;
+
+    // Member
+    std::string m_lineName;
+    //!< @brief Name of whole-line command for synthesized assembler lines.
+    uint64_t m_memorySize;
+    //!< @brief Available shared memory.
+    bool m_mergeAtFirst;
+    //!< @brief Position of line command in a coalesced run.
+};
+
+} /* End namespace as */
+
+#endif // LINECOALESCING_H
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LISTSCHEDULER_H
+#define LISTSCHEDULER_H
+
+#include "instructionset.h"
+#include "ipass.h"
+#include "latencymodel.h"
+#include <array>
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @class ListScheduler
+ *
+ * @brief Reorder instructions of straight-line regions to minimize estimated cycles.
+ *
+ * @details
+ * The stream is split into regions of instructions of the same innermost loop with at most
+ * "Timing.Window" (default=64) instructions. NOOP, FINISH and unknown commands end a region.
+ * For each region a dependency graph is built from the resources every instruction reads and
+ * writes: shared memory ranges, places of DIC and DOC lines, PC and CC lines, the line selects
+ * and the VCGRA. A computation reads the selected lines from START until WAIT_READY.
+ * The region is list scheduled with the LatencyModel: the instruction with the earliest start
+ * cycle is issued first, ties are broken by the longest latency path to the region end.
+ * The new order is kept only if the estimated execution of the region does not get worse.
+ */
+class ListScheduler : public IPass
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] isaA Instruction set to decode machine code words.
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    ListScheduler(const InstructionSet &isaA, const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~ListScheduler(void) = default;
+
+    virtual std::string getName(void) const override final;
+
+    virtual uint64_t run(InstructionStream &streamA) override final;
+
+    /**
+     * @brief Write number of scheduled regions and estimated cycles.
+     *
+     * @param[out] osA Output stream to write report to.
+     */
+    virtual void report(std::ostream &osA) const override final;
+
+  private:
+    /**
+     * @brief Resources of the VCGRA.
+     */
+    enum class RESOURCE
+    {
+        MEMORY, //!< @brief Shared memory (addresses)
+        DIC,    //!< @brief Data input cache (line * places + place)
+        DOC,    //!< @brief Data output cache (line * places + place)
+        PC,     //!< @brief Processing element configuration cache (line)
+        CC,     //!< @brief Virtual channel configuration cache (line)
+        SELECT, //!< @brief Line selects (0=DIC, 1=DOC, 2=PECC, 3=CHCC)
+        FABRIC  //!< @brief Computation of VCGRA
+    };
+
+    /**
+     * @brief Access of an instruction to a range of a resource.
+     */
+    struct Access
+    {
+        RESOURCE resource; //!< @brief Accessed resource
+        uint64_t begin;    //!< @brief First accessed element
+        uint64_t end;      //!< @brief Element behind last accessed element
+        bool write;        //!< @brief Resource is changed
+    };
+
+    /**
+     * @brief Get accesses of an instruction and update the selected lines.
+     *
+     * @param[in] wordA Machine code word.
+     * @param[out] accessA Accesses of instruction.
+     * @return False, if the instruction is a barrier for scheduling.
+     */
+    bool getAccesses(const uint64_t wordA, std::vector<Access> &accessA);
+
+    /**
+     * @brief Get accessed elements of a cache line or of all lines, if the line is unknown.
+     */
+    static Access getLine(const RESOURCE resA, const uint32_t lineA, const uint64_t placesA, const bool writeA);
+
+    /**
+     * @brief Check if two instructions have to keep their order.
+     */
+    static bool conflicts(const std::vector<Access> &firstA, const std::vector<Access> &secondA);
+
+    /**
+     * @brief Schedule a region.
+     *
+     * @param[in,out] instsA Instructions of stream.
+     * @param[in] beginA Position of first instruction of region.
+     * @param[in] accessA Accesses of instructions of region.
+     * @param[in,out] stateA Execution state at region begin, updated to region end.
+     * @return Number of moved instructions.
+     */
+    uint64_t schedule(std::vector<Instruction> &instsA, const std::size_t beginA,
+                      const std::vector<std::vector<Access>> &accessA, LatencyModel::State &stateA) const;
+
+    // Member
+    LatencyModel m_model;
+    //!< @brief Latency model to estimate cycles.
+    std::size_t m_window;
+    //!< @brief Maximal number of instructions of a region.
+    uint64_t m_dicPlaces, m_docPlaces;
+    //!< @brief Number of places of a DIC and DOC line.
+    uint64_t m_dicStride, m_docStride;
+    //!< @brief Shared memory address distance of neighbouring DIC and DOC places.
+    std::array<uint32_t, 4> m_selectIds;
+    //!< @brief Machine code IDs of SLCT_DIC_LINE, SLCT_DOC_LINE, SLCT_PECC_LINE and SLCT_CHCC_LINE.
+    std::array<uint32_t, 4> m_selected;
+    //!< @brief Selected lines during analysis, UINT32_MAX if unknown.
+    std::vector<Access> m_running;
+    //!< @brief Accesses of the last started computation during analysis.
+    uint32_t m_start, m_wait, m_loadd, m_loadda, m_stored, m_storeda, m_loadpc, m_loadcc;
+    //!< @brief Machine code IDs of commands.
+    uint64_t m_regions, m_cyclesBefore, m_cyclesAfter;
+    //!< @brief Number of reordered regions and estimated cycles of last run.
+    const InstructionSet &m_isa;
+    //!< @brief Instruction set to decode machine code words.
+};
+
+} /* End namespace as */
+
+#endif // LISTSCHEDULER_H
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOADCOALESCING_H
+#define LOADCOALESCING_H
+
+#include "linecoalescing.h"
+#include <boost/property_tree/ptree.hpp>
+
+namespace as
+{
+
+/**
+ * @class LoadCoalescing
+ *
+ * @brief Replace LOADD commands which fill a whole data input cache line by one LOADDA.
+ *
+ * @details
+ * The number of places of a line is "VCGRA_Property.Num_Dic_Places". The shared memory
+ * distance of neighbouring places is "VCGRA_Property.Dic_Place_Stride" (default=1).
+ * The LOADDA replaces the first LOADD of a run. A run is dropped, if the VCGRA runs
+ * (START, WAIT_READY, FINISH), shared memory is written (STORED, STOREDA) or the line is
+ * loaded with LOADDA between its LOADD commands.
+ */
+class LoadCoalescing : public LineCoalescing
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] isaA Instruction set to decode machine code words.
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    LoadCoalescing(const InstructionSet &isaA, const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~LoadCoalescing(void) = default;
+
+    virtual std::string getName(void) const override final;
+
+  protected:
+    virtual bool isBarrier(const Instruction &instA, const uint32_t lineA,
+                           const uint64_t baseA) const override final;
+
+  private:
+    // Member
+    std::vector<uint32_t> m_barrierIds;
+    //!< @brief Machine code IDs of commands which prevent coalescing on all lines.
+};
+
+} /* End namespace as */
+
+#endif // LOADCOALESCING_H
@@ -0,0 +1,140 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+
+/*
+ * Write a log message of level levelA (ERROR, WARN, INFO, DEBUG, TRACE) to loggerA, e.g.
+ * CGRA_LOG(m_log, DEBUG) << *parseObj << '\n';
+ * The message operands are not evaluated, if the level is disabled. The macro is a single
+ * expression, so it is also safe as the unbraced body of if/else.
+ */
+#define CGRA_LOG(loggerA, levelA)                                                                                      \
+    !(loggerA).isEnabled(as::Logger::LEVEL::levelA) ? (void)0 : as::LogVoidify() & (loggerA).stream()
+
+namespace as
+{
+
+/**
+ * @class Logger
+ *
+ * @brief Levelled log output of the assembler.
+ *
+ * @details
+ * A message is written, if its level is at most the level of the logger. Messages are
+ * written with the macro CGRA_LOG, which skips formatting of disabled messages. The
+ * level is selected by the configuration parameter "General.LogLevel" (default=info)
+ * or the command line option --log-level.
+ */
+class Logger
+{
+  public:
+    /**
+     * @brief Log levels in order of increasing verbosity.
+     */
+    enum class LEVEL : uint8_t
+    {
+        ERROR, //!< @brief Errors which abort the assembler run
+        WARN,  //!< @brief Unexpected conditions which do not abort the run
+        INFO,  //!< @brief Progress of the assembler run and requested reports
+        DEBUG, //!< @brief Created parse objects
+        TRACE  //!< @brief Every parsed assembler line
+    };
+
+    /**
+     * @brief General constructor
+     *
+     * @param[out] osA Output stream for enabled messages.
+     * @param[in] levelA Most verbose enabled level.
+     */
+    Logger(std::ostream &osA, const LEVEL levelA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~Logger(void) = default;
+
+    /**
+     * @brief Check if messages of a level are written.
+     */
+    inline bool isEnabled(const LEVEL levelA) const
+    {
+        return levelA <= m_level;
+    }
+
+    /**
+     * @brief Get most verbose enabled level.
+     */
+    LEVEL getLevel(void) const;
+
+    /**
+     * @brief Get output stream of enabled messages.
+     */
+    std::ostream &stream(void);
+
+    /**
+     * @brief Check if name is a log level (error, warn, info, debug, trace).
+     */
+    static bool isLevel(const std::string &nameA);
+
+    /**
+     * @brief Convert name to log level.
+     *
+     * @throws AssemblerException if name is not a log level.
+     *
+     * @param[in] nameA Name of log level.
+     */
+    static LEVEL toLevel(const std::string &nameA);
+
+  private:
+    // Forbidden constructors
+    Logger(const Logger &src) = delete;
+    Logger &operator=(const Logger &src) = delete;
+
+    // Member
+    std::ostream &m_os;
+    //!< @brief Output stream for enabled messages.
+    LEVEL m_level;
+    //!< @brief Most verbose enabled level.
+};
+
+/**
+ * @class LogVoidify
+ *
+ * @brief Helper of CGRA_LOG which turns a written stream into void.
+ *
+ * @details
+ * Operator & binds weaker than operator <<, so the whole message is written before the
+ * stream is discarded. Both branches of the conditional in CGRA_LOG are then of type void.
+ */
+class LogVoidify
+{
+  public:
+    void operator&(std::ostream &)
+    {
+        return;
+    }
+};
+
+} /* End namespace as */
+
+#endif // LOGGER_H
@@ -19,6 +19,7 @@
 #ifndef LOOP_H
 #define LOOP_H
 
+#include "instructionstream.h"
 #include "level.h"
 #include <boost/property_tree/ptree.hpp>
 #include <cstdint>
@@ -51,7 +52,7 @@ class Loop : public Level
      * @param[in] stepWidthA Stepwidth to adapt Loop index for each iteration.
      * @param[in] readCmdA Source code line of assembler file (human readable).
      */
-    Loop(Level *const parentLvlA, const uint32_t fileLineA, ParseObjBase *startValueA, ParseObjBase *endValueA,
+    Loop(Level *const parentLvlA, const uint64_t fileLineA, ParseObjBase *startValueA, ParseObjBase *endValueA,
          ParseObjBase *stepWidthA, const std::string readCmdA);
 
     /**
@@ -101,11 +102,73 @@ class Loop : public Level
     }
 
     /**
-     * @brief Interface function to implement assemble functionality.
+     * @brief Get file line number of loop declaration
+     *
+     * @return Copy of file line number
+     */
+    inline uint64_t getFileLine(void) const
+    {
+        return m_fileLine;
+    }
+
+    /**
+     * @brief Get assembler line of loop declaration
+     *
+     * @return Copy of assembler line
+     */
+    inline std::string getReadCommandLine(void) const
+    {
+        return m_readCommandLine;
+    }
+
+    /**
+     * @brief Get start value handle of loop range
+     */
+    inline ParseObjBase *getStartValue(void) const
+    {
+        return m_startValue;
+    }
+
+    /**
+     * @brief Get end value handle of loop range
+     */
+    inline ParseObjBase *getEndValue(void) const
+    {
+        return m_endValue;
+    }
+
+    /**
+     * @brief Get stepwidth handle of loop
+     */
+    inline ParseObjBase *getStepWidth(void) const
+    {
+        return m_stepWidth;
+    }
+
+    /**
+     * @brief Get number of times the loop was entered by assemble
+     */
+    inline uint64_t getEntries(void) const
+    {
+        return m_entries;
+    }
+
+    /**
+     * @brief Get number of iterations of all entries by assemble
+     */
+    inline uint64_t getIterations(void) const
+    {
+        return m_iterations;
+    }
+
+    /**
+     * @brief Unroll loop and append machine code of all iterations to an instruction stream.
      *
      * @param ptreeA Assembler object containing VCGRA configuration parameter
+     * @param streamA Instruction stream to append machine code words
+     * @return Reference to streamA
      */
-    std::ostream &assemble(const boost::property_tree::ptree &ptreeA, std::ostream &osA = std::cout);
+    InstructionStream &assemble(const boost::property_tree::ptree &ptreeA, InstructionStream &streamA);
 
   private:
     // Forbidden Constructors
@@ -116,7 +179,7 @@ class Loop : public Level
     // Private Members
     std::string m_readCommandLine;
     //!< @brief Line in assembler file to declare Loop conditions.
-    uint32_t m_fileLine;
+    uint64_t m_fileLine;
     //!< @brief File line number in assembler file where loop is declared.
     int32_t m_currentValue;
     //!< @brief Current value of loop index.
@@ -126,6 +189,10 @@ class Loop : public Level
     //!< @brief Start value for index loop of range.
     ParseObjBase *m_endValue;
     //!< @brief End value for index loop of range.
+    uint64_t m_entries{0};
+    //!< @brief Number of times the loop was entered by assemble.
+    uint64_t m_iterations{0};
+    //!< @brief Number of iterations of all entries by assemble.
 };
 
 } /* End namespace as */
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MEMORYASSEMBLER_H
+#define MEMORYASSEMBLER_H
+
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @class MemoryAssembler
+ *
+ * @brief Library interface to assemble programs from memory to machine code words.
+ *
+ * @details
+ * The assembler takes the source text and a loaded configuration and returns the
+ * encoded machine code words with the assembler source line of every word. It does
+ * not access the file system, "General.Output" and the output format options are not
+ * used. A memory assembler may be used by several threads concurrently, every call
+ * of assemble runs its own assembler instance. The library is linked with the CMake
+ * target cgra::asm.
+ */
+class MemoryAssembler
+{
+  public:
+    /**
+     * @brief Assembled program.
+     */
+    struct Program
+    {
+        std::vector<uint64_t> words; //!< @brief Encoded machine code words in program order
+        std::vector<uint64_t> lines; //!< @brief Assembler source line of each word (first line = 1)
+    };
+
+    /**
+     * @brief General constructor
+     *
+     * @param[in] configA Map of parameters from program configuration (copied).
+     */
+    explicit MemoryAssembler(const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~MemoryAssembler(void) = default;
+
+    /**
+     * @brief Load program configuration from XML text.
+     *
+     * @throws AssemblerException if the text is no valid XML.
+     *
+     * @param[in] xmlA Content of configuration file.
+     */
+    static boost::property_tree::ptree readConfig(const std::string &xmlA);
+
+    /**
+     * @brief Assemble a program.
+     *
+     * @throws AssemblerException if the program contains errors.
+     *
+     * @param[in] sourceA Assembler source text.
+     * @return Machine code words with source lines.
+     */
+    Program assemble(const std::string &sourceA) const;
+
+    /**
+     * @brief Assemble a program and write the assembler log.
+     *
+     * @throws AssemblerException if the program contains errors.
+     *
+     * @param[in] sourceA Assembler source text.
+     * @param[out] logA Logging stream (level of "General.LogLevel").
+     * @return Machine code words with source lines.
+     */
+    Program assemble(const std::string &sourceA, std::ostream &logA) const;
+
+    /**
+     * @brief Get access to configuration.
+     */
+    boost::property_tree::ptree &getConfig(void);
+
+  private:
+    // Member
+    boost::property_tree::ptree m_config;
+    //!< @brief Program configuration of all programs.
+};
+
+} /* End namespace as */
+
+#endif // MEMORYASSEMBLER_H
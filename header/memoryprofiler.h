@@ -0,0 +1,174 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef MEMORYPROFILER_H
+#define MEMORYPROFILER_H
+
+#include "instructionset.h"
+#include "instructionstream.h"
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+namespace as
+{
+
+// Forward declarations
+class Loop;
+
+/**
+ * @class MemoryProfiler
+ *
+ * @brief Analyze shared memory traffic and data reuse of an instruction stream.
+ *
+ * @details
+ * Every data transfer (LOADD, LOADDA, STORED, STOREDA) of the stream is split into accesses
+ * of the shared memory address of each place. The profiler collects
+ * - loaded and stored bytes per loop including its nested loops (like the cycles of the
+ *   PerformanceModel) and of the loop body itself,
+ * - a histogram of accesses per address range of "General.HistogramBucket" (default=256) bytes,
+ * - reuse distances: the number of distinct addresses accessed between two accesses of the
+ *   same address,
+ * - reloads: loads of an address, which was loaded before. A reload is redundant, if the
+ *   address was not stored in between, thus the data could have been kept in a cache.
+ */
+class MemoryProfiler
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] isaA Instruction set to decode machine code words.
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    MemoryProfiler(const InstructionSet &isaA, const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~MemoryProfiler(void) = default;
+
+    /**
+     * @brief Analyze data transfers of an instruction stream.
+     *
+     * @param[in] streamA Assembled instruction stream.
+     */
+    void run(const InstructionStream &streamA);
+
+    /**
+     * @brief Write traffic and reuse report of last run.
+     *
+     * @param[out] osA Output stream to write report to.
+     */
+    void report(std::ostream &osA) const;
+
+  private:
+    /**
+     * @brief Access of one place.
+     */
+    struct Access
+    {
+        uint64_t address; //!< @brief Shared memory address of place
+        uint64_t bytes;   //!< @brief Size of place
+        bool store;       //!< @brief Access is a store
+    };
+
+    /**
+     * @brief Traffic of a loop.
+     */
+    struct Traffic
+    {
+        uint64_t loaded;    //!< @brief Loaded bytes
+        uint64_t stored;    //!< @brief Stored bytes
+        uint64_t transfers; //!< @brief Data transfer commands
+    };
+
+    /**
+     * @brief Traffic of a loop and its nested loops.
+     */
+    struct LoopTraffic
+    {
+        const Loop *loop;   //!< @brief Loop (nullptr for top level)
+        std::size_t parent; //!< @brief Index of enclosing loop (SIZE_MAX for top level and its loops)
+        uint64_t depth;     //!< @brief Nesting depth (1 for loops of top level)
+        Traffic self;       //!< @brief Traffic of words emitted by the loop body itself
+        Traffic total;      //!< @brief Traffic including nested loops
+    };
+
+    /**
+     * @brief Access statistics of an address.
+     */
+    struct Address
+    {
+        uint64_t lastAccess;  //!< @brief Position of last access
+        uint64_t loads;       //!< @brief Number of loads
+        uint64_t reloads;     //!< @brief Loads of previously loaded data
+        uint64_t distanceSum; //!< @brief Sum of reuse distances of reloads
+        bool loaded;          //!< @brief Address was loaded before
+        bool clean;           //!< @brief Address was not stored since last load
+    };
+
+    /**
+     * @brief Split a machine code word into place accesses.
+     *
+     * @return False, if the word is no data transfer.
+     */
+    bool getAccesses(const uint64_t wordA, std::vector<Access> &accessA) const;
+
+    /**
+     * @brief Add traffic trafficA to sumA.
+     */
+    static void add(Traffic &sumA, const Traffic &trafficA);
+
+    /**
+     * @brief Get index of a loop in m_loops, add the loop and its enclosing loops if missing.
+     *
+     * @param[in] loopA Loop (nullptr for top level).
+     */
+    std::size_t getLoop(const Loop *loopA);
+
+    // Member
+    uint32_t m_loadd, m_loadda, m_stored, m_storeda;
+    //!< @brief Machine code IDs of data transfers.
+    uint64_t m_dicPlaces, m_docPlaces;
+    //!< @brief Number of places of a DIC and DOC line.
+    uint64_t m_dicStride, m_docStride;
+    //!< @brief Bytes per DIC and DOC place.
+    uint64_t m_bucket;
+    //!< @brief Address range of histogram bucket.
+    std::vector<LoopTraffic> m_loops;
+    //!< @brief Traffic per loop in order of first emitted word (enclosing loops first).
+    std::unordered_map<const Loop *, std::size_t> m_loopIndex;
+    //!< @brief Index of a loop in m_loops.
+    std::map<uint64_t, std::pair<uint64_t, uint64_t>> m_histogram;
+    //!< @brief Loads and stores per histogram bucket.
+    std::unordered_map<uint64_t, Address> m_addresses;
+    //!< @brief Statistics per accessed address.
+    std::vector<uint64_t> m_distances;
+    //!< @brief Number of reuses per reuse distance class (0, 1, 2-3, 4-7, ...).
+    uint64_t m_loads, m_reloads, m_redundant, m_firstAccesses;
+    //!< @brief Number of loads, reloads, redundant reloads and first accesses of an address.
+    const InstructionSet &m_isa;
+    //!< @brief Instruction set to decode machine code words.
+};
+
+} /* End namespace as */
+
+#endif // MEMORYPROFILER_H
@@ -42,7 +42,7 @@ class Mul : public IArithmetic
      * @param firstA Pointer to first variable for multiplication.
      * @param secondA Pointer to second variable for multiplication.
      */
-    Mul(Level *lvlA, const std::string &cmdLineA, const uint32_t lineNumberA, ParseObjBase *const firstA = nullptr,
+    Mul(Level *lvlA, const std::string &cmdLineA, const uint64_t lineNumberA, ParseObjBase *const firstA = nullptr,
         ParseObjBase *const secondA = nullptr);
 
     /**
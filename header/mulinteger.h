@@ -41,7 +41,7 @@ class MulInteger : public IArithmetic
      * @param firstA Pointer to first arithmetic operand (default=nullptr).
      * @param secondA Pointer to second arithmetic operand (default=nullptr).
      */
-    MulInteger(Level *lvlA, const std::string &cmdLineA, const uint32_t &lineNumberA, ParseObjBase *firstA = nullptr,
+    MulInteger(Level *lvlA, const std::string &cmdLineA, const uint64_t &lineNumberA, ParseObjBase *firstA = nullptr,
                ParseObjBase *secondA = nullptr);
 
     /**
@@ -43,26 +43,28 @@ class AssemblerException : public std::exception
      * \param[in] messageA Error description
      * \param[in] errorIdA Error ID (default = 0)
      */
-    AssemblerException(const std::string &messageA, const unsigned errorIdA = 0) : m_message{messageA}, m_id{errorIdA}
+    AssemblerException(const std::string &messageA, const unsigned errorIdA = 0)
+        : m_message{messageA}, m_id{errorIdA}, m_what{}
     {
+        std::ostringstream t_os;
+
+        t_os << "Error " << m_id << ": " << m_message << std::endl;
+
+        m_what = t_os.str();
     }
 
     /**
      * \brief Return error message.
      *
+     * \details
+     * The message is owned by the exception, thus exceptions of concurrent assemblers
+     * do not share any state.
+     *
      * \return Error message format: Error \<ID\>: \<Message\>
      */
     virtual const char *what() const throw() override
     {
-
-        std::ostringstream t_os;
-        t_os.str("");
-
-        t_os << "Error " << m_id << ": " << m_message << std::endl;
-
-        m_os = t_os.str();
-
-        return m_os.data();
+        return m_what.c_str();
     }
 
     /**
@@ -76,8 +78,8 @@ class AssemblerException : public std::exception
     //!< \brief Store error message.
     unsigned m_id;
     //!< \brief Store error ID.
-    static std::string m_os;
-    //!< \brief Static member function to create output message for what variable.
+    std::string m_what;
+    //!< \brief Output message for what function.
 
     // Forbidden Constructors
     AssemblerException() = delete;
@@ -48,7 +48,7 @@ class NoOperand : public ParseObjBase, public IAssemble
      * @param lineNumberA Assembler file line number.
      * @param machineIdA Machine Code ID for decode at VCGRA.
      */
-    NoOperand(Level *const lvlA, const std::string &cmdLineA, const uint32_t lineNumberA, const uint32_t machineIdA);
+    NoOperand(Level *const lvlA, const std::string &cmdLineA, const uint64_t lineNumberA, const uint32_t machineIdA);
 
     /**
      * @brief Copy constructor
@@ -113,6 +113,14 @@ class NoOperand : public ParseObjBase, public IAssemble
      */
     virtual std::string assemble(const boost::property_tree::ptree &ptreeA) override final;
 
+    /**
+     * @brief Create numeric machine code word from assembler command.
+     *
+     * @param ptreeA Property tree with configuration values from SW configuration file
+     * @return Machine code word for VCGRA instance.
+     */
+    virtual uint64_t encode(const boost::property_tree::ptree &ptreeA) override final;
+
   private:
     // Forbidden constructor
     NoOperand() = delete;
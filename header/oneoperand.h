@@ -51,7 +51,7 @@ class OneOperand : public ParseObjBase, public IAssemble
      * @param firstA Pointer to operand of assembler command.
      * @param machineIdA Machine code ID for assembler command.
      */
-    OneOperand(Level *const lvlA, const std::string &cmdLineA, uint32_t lineNumberA, ParseObjBase *const firstA,
+    OneOperand(Level *const lvlA, const std::string &cmdLineA, uint64_t lineNumberA, ParseObjBase *const firstA,
                const uint32_t machineIdA);
 
     /**
@@ -132,6 +132,14 @@ class OneOperand : public ParseObjBase, public IAssemble
      */
     virtual std::string assemble(const boost::property_tree::ptree &ptreeA) override final;
 
+    /**
+     * @brief Create numeric machine code word from assembler command.
+     *
+     * @param ptreeA Property tree with configuration values from SW configuration file
+     * @return Machine code word for VCGRA instance.
+     */
+    virtual uint64_t encode(const boost::property_tree::ptree &ptreeA) override final;
+
   private:
     // Forbidden constructors
     OneOperand(void) = delete;
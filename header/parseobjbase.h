@@ -68,7 +68,7 @@ class ParseObjBase
      * @param[in] cmdLineA cmdLineA: Copy of assembler line as string
      * @param[in] lineNumberA lineNumberA: Line number in assembler file where the current line exists.
      */
-    ParseObjBase(Level *levelA, COMMANDCLASS cmdA, const std::string &cmdLineA, const uint32_t lineNumberA);
+    ParseObjBase(Level *levelA, COMMANDCLASS cmdA, const std::string &cmdLineA, const uint64_t lineNumberA);
 
     /**
      * @brief Copy Constructor
@@ -112,9 +112,9 @@ class ParseObjBase
     /**
      * @brief Get line of assembler file.
      *
-     * @return uint32_t Assembler file line
+     * @return uint64_t Assembler file line
      */
-    virtual uint32_t getFileLineNumber() const final;
+    virtual uint64_t getFileLineNumber() const final;
 
     /**
      * @brief Get level of parse object.
@@ -151,7 +151,7 @@ class ParseObjBase
      * @param[in] newA New value for parsed line
      * @return Copy of previous value.
      */
-    virtual u_int32_t setLineNumber(const u_int32_t newA) final;
+    virtual uint64_t setLineNumber(const uint64_t newA) final;
 
     /**
      * @brief Set new level pointer.
@@ -188,7 +188,7 @@ class ParseObjBase
     //!< @brief Defines the type of parsed object
     std::string m_cmdLine;
     //!< @brief Stores the textual line from assembler file
-    uint32_t m_lineNumber;
+    uint64_t m_lineNumber;
     //!< @brief Stores the line in the assembler file where the parsed object was found.
 };
 
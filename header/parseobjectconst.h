@@ -42,7 +42,7 @@ class ParseObjectConst : public as::ParseObjBase
      * @param[in] lineNumberA Line number in assembler file
      */
     ParseObjectConst(const std::string &nameA, int32_t valueA, Level *lvlA, const std::string &cmdLineA,
-                     uint32_t lineNumberA);
+                     uint64_t lineNumberA);
 
     /**
      * @brief Copy constructor
@@ -47,7 +47,7 @@ class ParseObjectVariable : public as::ParseObjBase
      * @param[in] lineNumberA Line number in assembler file.
      */
     ParseObjectVariable(const std::string &nameA, const int32_t valueA, Level *lvlA, const std::string &cmdLineA,
-                        uint32_t lineNumberA);
+                        uint64_t lineNumberA);
 
     /**
      * @brief Copy constructor
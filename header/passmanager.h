@@ -0,0 +1,142 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PASSMANAGER_H
+#define PASSMANAGER_H
+
+#include "ilevelpass.h"
+#include "instructionset.h"
+#include "ipass.h"
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @class PassManager
+ *
+ * @brief Run optimization passes of an optimization level and collect their statistics.
+ *
+ * @details
+ * Passes are registered with the minimal optimization level they belong to (-O1, -O2).
+ * Level passes run on the parsed levels before they are unrolled, stream passes run on
+ * the instruction stream afterwards. Both run in order of registration. For each pass the
+ * number of changes, the stream size and the run time are recorded.
+ */
+class PassManager
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @throws AssemblerException if the assembler properties are missing for optimization level > 0.
+     *
+     * @param[in] configA Map of parameters from program configuration file.
+     * @param[in] levelA Optimization level (0 = no optimization).
+     */
+    PassManager(const boost::property_tree::ptree &configA, const unsigned levelA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~PassManager(void) = default;
+
+    /**
+     * @brief Get optimization level.
+     */
+    unsigned getLevel(void) const;
+
+    /**
+     * @brief Get instruction set for passes.
+     *
+     * @throws AssemblerException if optimization level is 0.
+     */
+    const InstructionSet &getInstructionSet(void) const;
+
+    /**
+     * @brief Register a pass on the parsed levels.
+     *
+     * @param[in] minLevelA Minimal optimization level of pass.
+     * @param[in] passA Pass to register. The manager takes ownership.
+     */
+    void addPass(const unsigned minLevelA, ILevelPass *passA);
+
+    /**
+     * @brief Register a pass on the instruction stream.
+     *
+     * @param[in] minLevelA Minimal optimization level of pass.
+     * @param[in] passA Pass to register. The manager takes ownership.
+     */
+    void addPass(const unsigned minLevelA, IPass *passA);
+
+    /**
+     * @brief Run registered level passes.
+     *
+     * @param[in,out] levelA Top level of parsed assembler file.
+     * @return Number of changes of all level passes.
+     */
+    uint64_t run(Level *const levelA);
+
+    /**
+     * @brief Run registered stream passes.
+     *
+     * @param[in,out] streamA Assembled instruction stream.
+     * @return Number of changes of all stream passes.
+     */
+    uint64_t run(InstructionStream &streamA);
+
+    /**
+     * @brief Write statistics and reports of all passes.
+     *
+     * @param[out] osA Output stream to write report to.
+     */
+    void report(std::ostream &osA) const;
+
+  private:
+    /**
+     * @brief Statistics of a pass run.
+     */
+    struct Statistics
+    {
+        uint64_t changes;     //!< @brief Number of applied changes
+        uint64_t wordsBefore; //!< @brief Stream size before stream pass
+        uint64_t wordsAfter;  //!< @brief Stream size after stream pass
+        double milliseconds;  //!< @brief Run time of pass
+    };
+
+    // Member
+    unsigned m_level;
+    //!< @brief Optimization level.
+    std::unique_ptr<InstructionSet> m_isa;
+    //!< @brief Instruction set for passes (only for optimization level > 0).
+    std::vector<std::unique_ptr<ILevelPass>> m_levelPasses;
+    //!< @brief Registered passes on parsed levels.
+    std::vector<Statistics> m_levelStats;
+    //!< @brief Statistics of level passes.
+    std::vector<std::unique_ptr<IPass>> m_streamPasses;
+    //!< @brief Registered passes on instruction stream.
+    std::vector<Statistics> m_streamStats;
+    //!< @brief Statistics of stream passes.
+};
+
+} /* End namespace as */
+
+#endif // PASSMANAGER_H
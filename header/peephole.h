@@ -0,0 +1,150 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PEEPHOLE_H
+#define PEEPHOLE_H
+
+#include "instructionset.h"
+#include "ipass.h"
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @class Peephole
+ *
+ * @brief Apply declarative rewrite rules on short instruction sequences of the stream.
+ *
+ * @details
+ * Rules are read from the configuration section "Optimizer.Peephole". Each "Rule" has a
+ * "Name", an optional minimal optimization "Level" (default=1), a "Match" pattern and a
+ * "Replace" list, e.g.
+ *
+ *     <Rule>
+ *         <Name>dic-select-overwrite</Name>
+ *         <Match>SLCT_DIC_LINE *; SLCT_DIC_LINE *</Match>
+ *         <Replace>$2</Replace>
+ *     </Rule>
+ *
+ * The match pattern is a list of commands separated by ';'. A command has no operands or all
+ * operands in assembler order (line; address line; address line place). An operand is either
+ * '*' (any value), a number or a name. All operands with the same name have to be equal.
+ * The replace list contains references $1..$n to the matched instructions, which are kept in
+ * the given order. It has to be shorter than the match pattern, thus rewriting terminates.
+ * A rule is applied again on the result of a rewrite until no rule matches anymore.
+ */
+class Peephole : public IPass
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @throws AssemblerException if a rule misses Name or Match, uses an unknown command or its replacement
+     * is not shorter.
+     *
+     * @param[in] isaA Instruction set to decode machine code words.
+     * @param[in] configA Map of parameters from program configuration file.
+     * @param[in] levelA Optimization level to select rules.
+     */
+    Peephole(const InstructionSet &isaA, const boost::property_tree::ptree &configA, const unsigned levelA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~Peephole(void) = default;
+
+    virtual std::string getName(void) const override final;
+
+    virtual uint64_t run(InstructionStream &streamA) override final;
+
+    /**
+     * @brief Write number of applications per rule.
+     *
+     * @param[out] osA Output stream to write report to.
+     */
+    virtual void report(std::ostream &osA) const override final;
+
+  private:
+    /**
+     * @brief Operand of a command pattern.
+     */
+    struct Operand
+    {
+        enum class KIND
+        {
+            ANY,     //!< @brief Matches every value
+            LITERAL, //!< @brief Matches a fixed value
+            BINDING  //!< @brief Matches the same value at all operands of the binding
+        } kind;
+        uint64_t value; //!< @brief Value of literal or index of binding
+    };
+
+    /**
+     * @brief Command pattern of a rule.
+     */
+    struct Pattern
+    {
+        uint32_t machineId;            //!< @brief Machine code ID of command
+        std::vector<Operand> operands; //!< @brief Operands in assembler order (empty matches any operands)
+    };
+
+    /**
+     * @brief Rewrite rule.
+     */
+    struct Rule
+    {
+        std::string name;              //!< @brief Name of rule for reports
+        std::vector<Pattern> match;    //!< @brief Matched instruction sequence
+        std::vector<std::size_t> keep; //!< @brief Positions of kept matched instructions
+        std::size_t numBindings;       //!< @brief Number of named operands
+        uint64_t applied;              //!< @brief Number of applications in last run
+    };
+
+    /**
+     * @brief Parse match pattern of a rule.
+     */
+    void parseMatch(Rule &ruleA, const std::string &matchA) const;
+
+    /**
+     * @brief Parse replace list of a rule.
+     */
+    void parseReplace(Rule &ruleA, const std::string &replaceA) const;
+
+    /**
+     * @brief Get operand values of a machine code word in assembler order.
+     */
+    std::vector<uint64_t> getOperands(const uint64_t wordA) const;
+
+    /**
+     * @brief Check if a rule matches the instructions in front of endA.
+     */
+    bool matches(const Rule &ruleA, const std::vector<Instruction> &instsA, const std::size_t endA) const;
+
+    // Member
+    std::vector<Rule> m_rules;
+    //!< @brief Rewrite rules of optimization level in configuration order.
+    const InstructionSet &m_isa;
+    //!< @brief Instruction set to decode machine code words.
+};
+
+} /* End namespace as */
+
+#endif // PEEPHOLE_H
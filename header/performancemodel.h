@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef PERFORMANCEMODEL_H
+#define PERFORMANCEMODEL_H
+
+#include "instructionset.h"
+#include "latencymodel.h"
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace as
+{
+
+// Forward declarations
+class Level;
+class Loop;
+
+/**
+ * @class PerformanceModel
+ *
+ * @brief Estimate execution cycles of loops from the parsed levels without unrolling.
+ *
+ * @details
+ * The cycles of one loop iteration are estimated with the LatencyModel from the commands
+ * of the loop body. A child loop adds its iteration cycles multiplied by its trip count,
+ * a running computation is finished at the end of each iteration. The trip count is
+ * derived from the loop range, variables in the range use their value at the time of the
+ * estimation (the initial value before assembling).
+ */
+class PerformanceModel
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] isaA Instruction set to decode machine code words.
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    PerformanceModel(const InstructionSet &isaA, const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~PerformanceModel(void) = default;
+
+    /**
+     * @brief Estimate cycles of a program.
+     *
+     * @param[in] levelA Top level of parsed assembler file.
+     * @return Estimated cycles of program.
+     */
+    uint64_t run(const Level *const levelA);
+
+    /**
+     * @brief Get estimated cycles of the whole program of last run.
+     */
+    uint64_t getCycles(void) const;
+
+    /**
+     * @brief Write loops ranked by estimated cycles.
+     *
+     * @param[out] osA Output stream to write report to.
+     */
+    void report(std::ostream &osA) const;
+
+  private:
+    /**
+     * @brief Estimation of a loop.
+     */
+    struct Estimate
+    {
+        const Loop *loop; //!< @brief Estimated loop
+        uint64_t depth;   //!< @brief Nesting depth (1 for loops of top level)
+        uint64_t entries; //!< @brief Number of loop entries
+        uint64_t trips;   //!< @brief Iterations per entry
+        uint64_t perIter; //!< @brief Cycles of one iteration
+        uint64_t total;   //!< @brief Cycles of all entries
+    };
+
+    /**
+     * @brief Estimate cycles of one pass through a level.
+     *
+     * @param[in] levelA Level to estimate.
+     * @param[in] entriesA Number of passes through the level.
+     * @param[in] depthA Nesting depth of level.
+     */
+    uint64_t estimate(const Level *const levelA, const uint64_t entriesA, const uint64_t depthA);
+
+    /**
+     * @brief Get number of iterations of a loop per entry.
+     */
+    static uint64_t getTrips(const Loop *const loopA);
+
+    // Member
+    LatencyModel m_model;
+    //!< @brief Latency model for commands.
+    std::vector<Estimate> m_loops;
+    //!< @brief Estimated loops of last run in program order.
+    uint64_t m_cycles;
+    //!< @brief Estimated cycles of last run.
+};
+
+} /* End namespace as */
+
+#endif // PERFORMANCEMODEL_H
@@ -0,0 +1,191 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef REGRESSION_H
+#define REGRESSION_H
+
+#include "simulator.h"
+#include <boost/filesystem.hpp>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @class Regression
+ *
+ * @brief Assemble a corpus of programs and compare output hashes and resource usage with references.
+ *
+ * @details
+ * Each case of the corpus file is one line "name program config hash [assembler options]".
+ * Paths are relative to the corpus file, lines starting with '#' are comments. The
+ * assembler executable runs in a child process with a copy of the configuration, which
+ * writes to the work directory. The hash covers the machine code words only, thus it
+ * does not depend on the output format. Wall time and peak resident set size are compared
+ * with a baseline file of the same machine. A case fails, if its hash differs from the
+ * golden hash or if a resource exceeds the baseline by more than the relative tolerance
+ * and an absolute slack. Cases without baseline entry record their usage as baseline.
+ *
+ * The output of every case is executed by the Simulator. The first case of a program
+ * is the reference of all further cases of the program (list the unoptimized case
+ * first). A case fails, if its shared memory differs from the reference or if it
+ * causes more hazards than the reference.
+ */
+class Regression
+{
+  public:
+    /**
+     * @brief Program of the corpus.
+     */
+    struct Case
+    {
+        std::string name;                //!< @brief Unique name of case
+        boost::filesystem::path program; //!< @brief Assembler file relative to corpus file
+        boost::filesystem::path config;  //!< @brief Configuration file relative to corpus file
+        uint64_t hash;                   //!< @brief Golden hash of machine code words
+        std::vector<std::string> args;   //!< @brief Additional assembler options
+    };
+
+    /**
+     * @brief Resource usage of a case.
+     */
+    struct Usage
+    {
+        double milliseconds; //!< @brief Wall time of assembler run
+        uint64_t rss;        //!< @brief Peak resident set size in KiB
+    };
+
+    /**
+     * @brief General constructor
+     *
+     * @param[in] assemblerA Path to assembler executable.
+     * @param[in] workDirA Directory for configurations, logs and output files.
+     */
+    Regression(const boost::filesystem::path &assemblerA, const boost::filesystem::path &workDirA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~Regression(void) = default;
+
+    /**
+     * @brief Set limits of performance comparison.
+     *
+     * @param[in] toleranceA Relative tolerance (0.25 = 25% slower or larger).
+     * @param[in] timeSlackA Absolute tolerance of wall time in milliseconds.
+     * @param[in] rssSlackA Absolute tolerance of peak resident set size in KiB.
+     */
+    void setTolerance(const double toleranceA, const double timeSlackA, const uint64_t rssSlackA);
+
+    /**
+     * @brief Read cases of a corpus file.
+     *
+     * @throws AssemblerException if the file cannot be opened or a line is malformed.
+     */
+    void loadCorpus(const boost::filesystem::path &corpusA);
+
+    /**
+     * @brief Read performance baseline. A missing file is an empty baseline.
+     *
+     * @throws AssemblerException if a line is malformed.
+     */
+    void loadBaseline(const boost::filesystem::path &baselineA);
+
+    /**
+     * @brief Write performance baseline.
+     *
+     * @throws AssemblerException if the file cannot be opened.
+     */
+    void writeBaseline(const boost::filesystem::path &baselineA) const;
+
+    /**
+     * @brief Run all cases whose name contains filterA.
+     *
+     * @param[out] logA Stream to write results to.
+     * @param[in] filterA Name filter (empty runs all cases).
+     * @param[in] updateA Replace baseline entries by measured usage instead of comparing.
+     * @return True, if all cases passed.
+     */
+    bool run(std::ostream &logA, const std::string &filterA, const bool updateA);
+
+    /**
+     * @brief Write corpus lines with the hashes of the last run.
+     *
+     * @param[out] osA Output stream to write corpus lines to.
+     */
+    void writeHashes(std::ostream &osA) const;
+
+    /**
+     * @brief Compute FNV-1a hash of machine code words.
+     */
+    static uint64_t hash(const std::vector<uint64_t> &wordsA);
+
+  private:
+    /**
+     * @brief Run assembler for a case.
+     *
+     * @throws AssemblerException if the assembler fails.
+     *
+     * @param[in] caseA Case to run.
+     * @param[out] usageA Measured resource usage.
+     * @return Machine code words of output file.
+     */
+    std::vector<uint64_t> execute(const Case &caseA, Usage &usageA) const;
+
+    /**
+     * @brief Simulate machine code of a case and compare it with the reference of its program.
+     *
+     * @throws AssemblerException if the simulation fails.
+     *
+     * @param[in] caseA Case of machine code.
+     * @param[in] wordsA Machine code words.
+     * @param[out] errorsA List of deviations from reference.
+     */
+    void verify(const Case &caseA, const std::vector<uint64_t> &wordsA, std::vector<std::string> &errorsA);
+
+    // Member
+    boost::filesystem::path m_assembler;
+    //!< @brief Path to assembler executable.
+    boost::filesystem::path m_workDir;
+    //!< @brief Directory for configurations, logs and output files.
+    double m_tolerance;
+    //!< @brief Relative tolerance of performance comparison.
+    double m_timeSlack;
+    //!< @brief Absolute tolerance of wall time in milliseconds.
+    uint64_t m_rssSlack;
+    //!< @brief Absolute tolerance of peak resident set size in KiB.
+    boost::filesystem::path m_corpusDir;
+    //!< @brief Directory of corpus file.
+    std::vector<Case> m_cases;
+    //!< @brief Cases of corpus in file order.
+    std::map<std::string, Usage> m_baseline;
+    //!< @brief Performance baseline per case name.
+    std::map<std::string, uint64_t> m_hashes;
+    //!< @brief Hashes of last run per case name.
+    std::map<std::string, std::pair<std::string, Simulator::Statistics>> m_references;
+    //!< @brief Reference case name and simulation statistics of last run per program.
+    std::map<std::string, std::vector<uint8_t>> m_referenceMemory;
+    //!< @brief Shared memory after simulation of reference case per program.
+};
+
+} /* End namespace as */
+
+#endif // REGRESSION_H
@@ -49,7 +49,7 @@ class ResetVariable : public ParseObjBase
      * @param valHandleA Handle for reset value for variable
      * @param varHandleA Handle for variable to control
      */
-    ResetVariable(Level *const lvlA, const std::string &cmdLineA, const uint32_t lineNumberA, as::ParseObjBase *const valHandleA,
+    ResetVariable(Level *const lvlA, const std::string &cmdLineA, const uint64_t lineNumberA, as::ParseObjBase *const valHandleA,
                   as::ParseObjBase *const varHandleA);
 
     /**
@@ -97,6 +97,16 @@ class ResetVariable : public ParseObjBase
      */
     void resetVariable();
 
+    /**
+     * @brief Get handle of variable to reset
+     */
+    as::ParseObjBase *getVariable(void) const;
+
+    /**
+     * @brief Get handle of reset value
+     */
+    as::ParseObjBase *getValue(void) const;
+
   private:
     // Forbidden constructor
     ResetVariable() = delete;
@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SELECTELIMINATION_H
+#define SELECTELIMINATION_H
+
+#include "instructionset.h"
+#include "ipass.h"
+#include <array>
+
+namespace as
+{
+
+/**
+ * @class SelectElimination
+ *
+ * @brief Remove line select commands which select the already selected cache line.
+ *
+ * @details
+ * The pass tracks the selected line of the data input cache (SLCT_DIC_LINE),
+ * data output cache (SLCT_DOC_LINE), PE configuration cache (SLCT_PECC_LINE) and
+ * channel configuration cache (SLCT_CHCC_LINE) along the unrolled instruction stream.
+ * Because loops are unrolled, selections are tracked across loop boundaries.
+ * Select commands that are not available in the configuration are ignored.
+ */
+class SelectElimination : public IPass
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] isaA Instruction set to decode machine code words.
+     */
+    SelectElimination(const InstructionSet &isaA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~SelectElimination(void) = default;
+
+    virtual std::string getName(void) const override final;
+
+    virtual uint64_t run(InstructionStream &streamA) override final;
+
+  private:
+    // Member
+    std::array<uint32_t, 4> m_selectIds;
+    //!< @brief Machine code IDs of the select commands for DIC, DOC, PECC and CHCC.
+    const InstructionSet &m_isa;
+    //!< @brief Instruction set to decode machine code words.
+};
+
+} /* End namespace as */
+
+#endif // SELECTELIMINATION_H
@@ -0,0 +1,153 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SERVER_H
+#define SERVER_H
+
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+namespace as
+{
+
+/**
+ * @class Server
+ *
+ * @brief Assembler daemon which answers assemble requests on a Unix domain socket.
+ *
+ * @details
+ * Every message is a frame "TYPE LENGTH [NAME]\n" followed by LENGTH bytes of payload.
+ * A client sends frames of type ASSEMBLE or SHUTDOWN and may send several requests on
+ * one connection. A request frame with more than 64 MiB payload is answered with an
+ * ERROR frame and the connection is closed. The payload of ASSEMBLE starts with lines "key=value", followed by an
+ * empty line and the inline assembler source, if no file is given:
+ *   - config: Configuration file (default: configuration of the server)
+ *   - file: Assembler file (alternative to inline source)
+ *   - name: Name of the output file for inline source (default: Assembler)
+ *   - format, optimize, shard-size, comments, log-level: Override "General" options
+ *
+ * The reply of a request is one frame "FILE LENGTH NAME" per output file, a frame
+ * "LOG LENGTH" with the assembler log, if not empty, and a final frame "OK 0" or
+ * "ERROR LENGTH" with the error message. Configurations are loaded once and reloaded,
+ * if the file changes. Replies are cached by the content of the source, the request
+ * options and the configuration, thus an unchanged program is answered without
+ * assembling it again.
+ */
+class Server
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] socketPathA Path of Unix domain socket.
+     * @param[in] configA Configuration of requests without config option.
+     */
+    Server(const boost::filesystem::path &socketPathA, const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor, removes socket and work directory.
+     */
+    virtual ~Server(void);
+
+    /**
+     * @brief Answer requests until a SHUTDOWN frame is received.
+     *
+     * @details
+     * An error while answering a connection closes the connection only. The socket file
+     * is removed when the server stops, also if it stops with an exception.
+     *
+     * @throws AssemblerException if the socket cannot be created.
+     *
+     * @param[out] osA Output stream for server messages.
+     */
+    void run(std::ostream &osA);
+
+    /**
+     * @brief Answer the payload of an ASSEMBLE frame.
+     *
+     * @param[in] payloadA Request options and inline source.
+     * @return Reply frames.
+     */
+    std::string assemble(const std::string &payloadA);
+
+    /**
+     * @brief Create frame of a message.
+     *
+     * @param[in] typeA Frame type.
+     * @param[in] payloadA Payload of frame.
+     * @param[in] nameA Optional name (e.g. file name of a FILE frame).
+     */
+    static std::string frame(const std::string &typeA, const std::string &payloadA, const std::string &nameA = "");
+
+  private:
+    /**
+     * @brief Configuration file with modification time at loading.
+     */
+    struct Config
+    {
+        std::time_t modified;               //!< @brief Modification time of file when loaded
+        boost::property_tree::ptree config; //!< @brief Loaded configuration
+    };
+
+    /**
+     * @brief Answer all requests of a connection.
+     *
+     * @param[in] fdA Socket of connection.
+     * @return False, if a SHUTDOWN frame was received.
+     */
+    bool serve(const int fdA);
+
+    /**
+     * @brief Get configuration of a file from cache, load it if it is missing or changed.
+     *
+     * @throws AssemblerException if the configuration cannot be loaded.
+     *
+     * @param[in] pathA Path to configuration file.
+     * @param[out] modifiedA Modification time of configuration file.
+     */
+    const boost::property_tree::ptree &getConfig(const std::string &pathA, std::time_t &modifiedA);
+
+    // Forbidden constructors
+    Server(const Server &src) = delete;
+    Server &operator=(const Server &src) = delete;
+
+    // Member
+    boost::filesystem::path m_socketPath;
+    //!< @brief Path of Unix domain socket.
+    boost::property_tree::ptree m_config;
+    //!< @brief Configuration of requests without config option.
+    boost::filesystem::path m_workDir;
+    //!< @brief Directory for inline sources and output files.
+    std::map<std::string, Config> m_configs;
+    //!< @brief Loaded configuration files.
+    std::unordered_map<std::string, std::string> m_replies;
+    //!< @brief Cached replies by request options, configuration modification time and source.
+    uint64_t m_requests;
+    //!< @brief Number of answered requests.
+    uint64_t m_hits;
+    //!< @brief Number of requests answered from cache.
+};
+
+} /* End namespace as */
+
+#endif // SERVER_H
@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SHARDEDWRITER_H
+#define SHARDEDWRITER_H
+
+#include "ioutputwriter.h"
+
+namespace as
+{
+
+/**
+ * @class ShardedWriter
+ *
+ * @brief Split machine code into several translation units of bounded size.
+ *
+ * @details
+ * The machine code is written into chunks of at most "General.ShardSize" words
+ * (output format "sharded"). Each chunk is stored as a static constant array in a
+ * source file <stem>_<n>.cpp next to the output header. The output header declares
+ * the chunks and provides a chunk table, thus the chunks can be compiled in parallel.
+ */
+class ShardedWriter : public IOutputWriter
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @throws AssemblerException if the configured shard size is zero.
+     *
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    ShardedWriter(const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~ShardedWriter(void) = default;
+
+    /**
+     * @brief Write machine code of an instruction stream to chunk files and the output header.
+     *
+     * @throws AssemblerException if an output file cannot be opened.
+     *
+     * @param[in] streamA Assembled instruction stream.
+     * @param[in] outPathA Path to output header file.
+     * @return List of written files (header first).
+     */
+    virtual std::vector<boost::filesystem::path> write(const InstructionStream &streamA,
+                                                       const boost::filesystem::path &outPathA) override;
+
+  private:
+    /**
+     * @brief Get path of a chunk source file.
+     *
+     * @param[in] outPathA Path to output header file.
+     * @param[in] chunkA Index of chunk.
+     */
+    static boost::filesystem::path getChunkPath(const boost::filesystem::path &outPathA, const uint64_t chunkA);
+
+    // Member
+    uint64_t m_shardSize;
+    //!< @brief Maximum number of machine code words per chunk.
+};
+
+} /* End namespace as */
+
+#endif // SHARDEDWRITER_H
@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef SIMULATOR_H
+#define SIMULATOR_H
+
+#include "instructionset.h"
+#include "latencymodel.h"
+#include <array>
+#include <boost/filesystem.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+namespace as
+{
+
+/**
+ * @class Simulator
+ *
+ * @brief Functional instruction-level simulator of a VCGRA instance.
+ *
+ * @details
+ * The simulator executes machine code words on a model of the shared memory
+ * ("VCGRA_Property.Available_Memory" bytes), the DIC and DOC lines and places,
+ * the PC and CC lines and the line selects. A place holds the data of
+ * "Dic_Place_Stride" (DIC) or "Doc_Place_Stride" (DOC) bytes of shared memory.
+ *
+ * The function of the VCGRA is not known to the assembler, thus a computation is
+ * modelled by a hash: each place of the selected DOC line gets a value derived from
+ * the selected DIC line and the selected PC and CC lines. Inputs are read at START,
+ * outputs are visible after WAIT_READY. The selected lines are latched at START, thus
+ * selects during a computation are allowed. Changes of the latched lines during a
+ * computation are counted as hazards. Equal programs produce equal memory contents,
+ * which allows to compare an optimized program with its reference.
+ *
+ * Execution cycles are estimated with the LatencyModel.
+ */
+class Simulator
+{
+  public:
+    /**
+     * @brief Statistics of a simulation run.
+     */
+    struct Statistics
+    {
+        uint64_t instructions;            //!< @brief Executed machine code words
+        std::vector<uint64_t> perCommand; //!< @brief Executed words per machine code ID
+        uint64_t bytesLoaded;             //!< @brief Bytes read from shared memory into DIC
+        uint64_t bytesStored;             //!< @brief Bytes written from DOC into shared memory
+        uint64_t configLoads;             //!< @brief Loaded PC and CC lines
+        uint64_t computations;            //!< @brief Started computations
+        uint64_t hazards;                 //!< @brief Accesses to resources of a running computation
+        uint64_t cycles;                  //!< @brief Estimated execution cycles
+    };
+
+    /**
+     * @brief General constructor
+     *
+     * @throws AssemblerException if the VCGRA properties are missing in the configuration or a place
+     * stride is not in range 1 to 8 bytes.
+     *
+     * @param[in] isaA Instruction set to decode machine code words.
+     * @param[in] configA Map of parameters from program configuration file.
+     * @param[in] seedA Seed of initial shared memory content.
+     */
+    Simulator(const InstructionSet &isaA, const boost::property_tree::ptree &configA, const uint64_t seedA = 1);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~Simulator(void) = default;
+
+    /**
+     * @brief Execute a program from the initial state until FINISH or its end.
+     *
+     * @throws AssemblerException on invalid commands or accesses.
+     *
+     * @param[in] programA Machine code words.
+     */
+    void run(const std::vector<uint64_t> &programA);
+
+    /**
+     * @brief Get shared memory content.
+     */
+    const std::vector<uint8_t> &getMemory(void) const;
+
+    /**
+     * @brief Get statistics of last run.
+     */
+    const Statistics &getStatistics(void) const;
+
+    /**
+     * @brief Write statistics of last run.
+     *
+     * @param[out] osA Output stream to write report to.
+     */
+    void report(std::ostream &osA) const;
+
+    /**
+     * @brief Read machine code words from files created by an output writer.
+     *
+     * @details
+     * Words are read from initializer lines of the output formats vector, sharded and
+     * constexpr. A sharded header without words is replaced by its chunk files.
+     *
+     * @throws AssemblerException if a file cannot be opened or contains no words.
+     *
+     * @param[in] pathA Path to output file.
+     * @return Machine code words in program order.
+     */
+    static std::vector<uint64_t> readProgram(const boost::filesystem::path &pathA);
+
+  private:
+    /**
+     * @brief Behaviour of a machine code ID.
+     */
+    enum class KIND : uint8_t
+    {
+        UNKNOWN,
+        NOOP,
+        START,
+        WAIT,
+        FINISH,
+        LOADD,
+        LOADDA,
+        STORED,
+        STOREDA,
+        LOADPC,
+        LOADCC,
+        SELECT
+    };
+
+    /**
+     * @brief Reset memory, caches and statistics to the initial state.
+     */
+    void reset(void);
+
+    /**
+     * @brief Read words from one file.
+     */
+    static bool readWords(const boost::filesystem::path &pathA, std::vector<uint64_t> &wordsA);
+
+    /**
+     * @brief Read data of a place from shared memory.
+     */
+    uint64_t load(const uint64_t addrA, const uint64_t bytesA, const uint64_t wordIdxA);
+
+    /**
+     * @brief Write data of a place to shared memory.
+     */
+    void store(const uint64_t addrA, const uint64_t bytesA, const uint64_t valueA, const uint64_t wordIdxA);
+
+    /**
+     * @brief Check a cache line and place of a word.
+     */
+    void check(const uint32_t lineA, const uint32_t numLinesA, const uint32_t placeA, const uint32_t numPlacesA,
+               const uint64_t wordIdxA) const;
+
+    /**
+     * @brief Compute outputs of the VCGRA at START.
+     */
+    void compute(void);
+
+    /**
+     * @brief Write outputs of a running computation to its DOC line.
+     */
+    void complete(void);
+
+    // Member
+    LatencyModel m_model;
+    //!< @brief Latency model to estimate cycles.
+    std::vector<KIND> m_kinds;
+    //!< @brief Behaviour per machine code ID.
+    std::vector<uint32_t> m_selectIdx;
+    //!< @brief Index of line select (0=DIC, 1=DOC, 2=PECC, 3=CHCC) per machine code ID.
+    uint64_t m_seed;
+    //!< @brief Seed of initial shared memory content.
+    uint32_t m_dicLines, m_dicPlaces, m_docLines, m_docPlaces, m_pcLines, m_ccLines;
+    //!< @brief Number of cache lines and places.
+    uint64_t m_dicStride, m_docStride;
+    //!< @brief Bytes per DIC and DOC place.
+    std::vector<uint8_t> m_memory;
+    //!< @brief Shared memory.
+    std::vector<uint64_t> m_dic, m_doc, m_pc, m_cc;
+    //!< @brief Cache contents (line * places + place for data caches).
+    std::array<uint32_t, 4> m_selected;
+    //!< @brief Selected lines of DIC, DOC, PECC and CHCC.
+    std::array<uint32_t, 4> m_running;
+    //!< @brief Selected lines of running computation.
+    std::vector<uint64_t> m_outputs;
+    //!< @brief Outputs of running computation.
+    bool m_busy;
+    //!< @brief A computation is running.
+    Statistics m_stats;
+    //!< @brief Statistics of last run.
+    const InstructionSet &m_isa;
+    //!< @brief Instruction set to decode machine code words.
+};
+
+} /* End namespace as */
+
+#endif // SIMULATOR_H
@@ -0,0 +1,87 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef STORECOALESCING_H
+#define STORECOALESCING_H
+
+#include "linecoalescing.h"
+#include <boost/property_tree/ptree.hpp>
+#include <utility>
+
+namespace as
+{
+
+/**
+ * @class StoreCoalescing
+ *
+ * @brief Replace STORED commands which write a whole data output cache line by one STOREDA.
+ *
+ * @details
+ * The number of places of a line is "VCGRA_Property.Num_Doc_Places". The shared memory
+ * distance of neighbouring places is "VCGRA_Property.Doc_Place_Stride" (default=1).
+ * The STOREDA replaces the last STORED of a run, thus the former STORED commands are
+ * delayed. A run is dropped, if the VCGRA runs (START, WAIT_READY, FINISH) and can change
+ * the line contents, if configuration caches are loaded (LOADPC, LOADCC) or if shared memory
+ * of the line is read or written by another command between its STORED commands.
+ * Saved instructions are reported per innermost loop.
+ */
+class StoreCoalescing : public LineCoalescing
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] isaA Instruction set to decode machine code words.
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    StoreCoalescing(const InstructionSet &isaA, const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~StoreCoalescing(void) = default;
+
+    virtual std::string getName(void) const override final;
+
+    virtual uint64_t run(InstructionStream &streamA) override final;
+
+    virtual void report(std::ostream &osA) const override final;
+
+  protected:
+    virtual bool isBarrier(const Instruction &instA, const uint32_t, const uint64_t baseA) const override final;
+
+    virtual void coalesced(const Instruction &instA, const uint64_t removedA) override final;
+
+  private:
+    // Member
+    std::vector<uint32_t> m_barrierIds;
+    //!< @brief Machine code IDs of commands which prevent coalescing on all lines.
+    uint32_t m_loaddId;
+    //!< @brief Machine code ID of LOADD.
+    uint32_t m_loaddaId;
+    //!< @brief Machine code ID of LOADDA.
+    uint64_t m_dicStride;
+    //!< @brief Shared memory size of a data input cache place.
+    uint64_t m_dicLineSize;
+    //!< @brief Shared memory size of a data input cache line.
+    std::vector<std::pair<const Loop *, uint64_t>> m_savings;
+    //!< @brief Saved instructions per innermost loop of last run (nullptr for top level).
+};
+
+} /* End namespace as */
+
+#endif // STORECOALESCING_H
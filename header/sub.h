@@ -42,7 +42,7 @@ class Sub : public IArithmetic
      * @param firstA Pointer to first variable for substraction.
      * @param secondA Pointer to second variable for substraction.
      */
-    Sub(Level *lvlA, const std::string &cmdLineA, const uint32_t lineNumberA, ParseObjBase *const firstA = nullptr,
+    Sub(Level *lvlA, const std::string &cmdLineA, const uint64_t lineNumberA, ParseObjBase *const firstA = nullptr,
         ParseObjBase *const secondA = nullptr);
 
     /**
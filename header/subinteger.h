@@ -41,7 +41,7 @@ class SubInteger : public IArithmetic
      * @param firstA Pointer to first arithmetic operand (default=nullptr).
      * @param secondA Pointer to second arithmetic operand (default=nullptr).
      */
-    SubInteger(Level *lvlA, const std::string &cmdLineA, const uint32_t &lineNumberA, ParseObjBase *firstA = nullptr,
+    SubInteger(Level *lvlA, const std::string &cmdLineA, const uint64_t &lineNumberA, ParseObjBase *firstA = nullptr,
                ParseObjBase *secondA = nullptr);
 
     /**
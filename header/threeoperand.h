@@ -55,7 +55,7 @@ class ThreeOperand : public ParseObjBase, public IAssemble
      * @param thridA Handle to third argument of parsed command.
      * @param machienIdA Machine code ID for parsed command.
      */
-    ThreeOperand(Level *const lvlA, const std::string &cmdLineA, const uint32_t lineNumber, ParseObjBase *const firstA,
+    ThreeOperand(Level *const lvlA, const std::string &cmdLineA, const uint64_t lineNumber, ParseObjBase *const firstA,
                  ParseObjBase *const secondA, ParseObjBase *const thridA, const uint32_t machienIdA);
 
     /**
@@ -191,6 +191,14 @@ class ThreeOperand : public ParseObjBase, public IAssemble
      */
     virtual std::string assemble(const boost::property_tree::ptree &ptreeA) override final;
 
+    /**
+     * @brief Create numeric machine code word from assembler command.
+     *
+     * @param ptreeA Property tree with configuration values from SW configuration file
+     * @return Machine code word for VCGRA instance.
+     */
+    virtual uint64_t encode(const boost::property_tree::ptree &ptreeA) override final;
+
   private:
     ParseObjBase *m_first;
     //!< @brief Handle to first operand
@@ -0,0 +1,194 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*
+ * Trace points of the assembler. They compile to nothing, if the build option
+ * CGRA_TRACE is disabled. CGRA_TRACE_SPAN opens a span until the end of the scope,
+ * CGRA_TRACE_ARG adds an argument to the span of the scope and CGRA_TRACE_DECL
+ * declares a variable which is only needed for trace arguments.
+ */
+#ifdef CGRA_ENABLE_TRACE
+#define CGRA_TRACE_SPAN(nameA, categoryA) as::Tracer::Span t_traceSpan{nameA, categoryA}
+#define CGRA_TRACE_ARG(keyA, valueA) t_traceSpan.addArg(keyA, valueA)
+#define CGRA_TRACE_DECL(declA) declA
+#else
+#define CGRA_TRACE_SPAN(nameA, categoryA)
+#define CGRA_TRACE_ARG(keyA, valueA)
+#define CGRA_TRACE_DECL(declA)
+#endif
+
+namespace as
+{
+
+/**
+ * @class Tracer
+ *
+ * @brief Record spans of assembler internals in Chrome trace event format.
+ *
+ * @details
+ * Spans are recorded into the active tracer, which is set by setCurrent. Without an
+ * active tracer a span does not read the clock. The written JSON file can be opened
+ * with chrome://tracing or the Perfetto UI.
+ */
+class Tracer
+{
+  public:
+    /**
+     * @class Span
+     *
+     * @brief Record the run time of a scope as complete event of the active tracer.
+     */
+    class Span
+    {
+      public:
+        /**
+         * @brief Open span.
+         *
+         * @param[in] nameA Name of span.
+         * @param[in] categoryA Category of span (e.g. "parse", "pass").
+         */
+        Span(const char *nameA, const char *categoryA);
+
+        /**
+         * @brief Open span with a name created at run time.
+         */
+        Span(const std::string &nameA, const char *categoryA);
+
+        /**
+         * @brief Close span and record it.
+         */
+        ~Span(void);
+
+        /**
+         * @brief Add numerical argument to span.
+         */
+        void addArg(const char *keyA, const uint64_t valueA);
+
+        /**
+         * @brief Add string argument to span.
+         */
+        void addArg(const char *keyA, const std::string &valueA);
+
+      private:
+        // Forbidden constructors
+        Span(const Span &src) = delete;
+        Span &operator=(const Span &src) = delete;
+
+        // Member
+        Tracer *m_tracer;
+        //!< @brief Active tracer at opening of span (nullptr, if tracing is disabled).
+        std::string m_name;
+        //!< @brief Name of span.
+        const char *m_category;
+        //!< @brief Category of span.
+        std::chrono::steady_clock::time_point m_begin;
+        //!< @brief Opening time of span.
+        std::string m_args;
+        //!< @brief Arguments of span as JSON members.
+    };
+
+    /**
+     * @brief Empty constructor
+     */
+    Tracer(void);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~Tracer(void);
+
+    /**
+     * @brief Set active tracer of the calling thread.
+     *
+     * @param[in] tracerA Tracer to record into (nullptr disables tracing).
+     */
+    static void setCurrent(Tracer *tracerA);
+
+    /**
+     * @brief Get active tracer (nullptr, if tracing is disabled).
+     */
+    static Tracer *getCurrent(void);
+
+    /**
+     * @brief Check if trace points are compiled in.
+     */
+    static bool isAvailable(void);
+
+    /**
+     * @brief Get number of recorded events.
+     */
+    uint64_t size(void) const;
+
+    /**
+     * @brief Add events of another tracer (e.g. of a worker thread).
+     *
+     * @details
+     * Times of the events are shifted to the creation time of this tracer.
+     *
+     * @param[in] otherA Tracer to add.
+     * @param[in] threadA Thread ID of the added events in the written trace.
+     */
+    void merge(const Tracer &otherA, const uint32_t threadA);
+
+    /**
+     * @brief Write recorded events as JSON object.
+     *
+     * @param[out] osA Output stream to write trace to.
+     */
+    void write(std::ostream &osA) const;
+
+  private:
+    /**
+     * @brief Complete event of a span.
+     */
+    struct Event
+    {
+        std::string name;     //!< @brief Name of span
+        const char *category; //!< @brief Category of span
+        double begin;         //!< @brief Opening time in microseconds since tracer creation
+        double duration;      //!< @brief Duration in microseconds
+        std::string args;     //!< @brief Arguments as JSON members
+        uint32_t thread;      //!< @brief Thread ID (1 = thread of tracer)
+    };
+
+    // Forbidden constructors
+    Tracer(const Tracer &src) = delete;
+    Tracer &operator=(const Tracer &src) = delete;
+
+    // Member
+    std::chrono::steady_clock::time_point m_start;
+    //!< @brief Creation time of tracer.
+    std::vector<Event> m_events;
+    //!< @brief Recorded events in order of closing (merged events in order of merging).
+
+    // Class static members
+    static thread_local Tracer *current;
+    //!< @brief Active tracer of thread (nullptr, if tracing is disabled).
+};
+
+} /* End namespace as */
+
+#endif // TRACER_H
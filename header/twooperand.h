@@ -51,7 +51,7 @@ class TwoOperand : public ParseObjBase, public IAssemble
      * @param secondA Pointer to second operand.
      * @param machineIdA VCGRA machine code ID for command parser at VCGRA.
      */
-    TwoOperand(Level *const lvlA, const std::string &cmdLineA, const uint32_t lineNumberA, ParseObjBase *const firstA,
+    TwoOperand(Level *const lvlA, const std::string &cmdLineA, const uint64_t lineNumberA, ParseObjBase *const firstA,
                ParseObjBase *const secondA, const uint32_t machineIdA);
 
     /**
@@ -171,6 +171,14 @@ class TwoOperand : public ParseObjBase, public IAssemble
      */
     virtual std::string assemble(const boost::property_tree::ptree &ptreeA) override final;
 
+    /**
+     * @brief Create numeric machine code word from assembler command.
+     *
+     * @param ptreeA Property tree with configuration values from SW configuration file
+     * @return Machine code word for VCGRA instance.
+     */
+    virtual uint64_t encode(const boost::property_tree::ptree &ptreeA) override final;
+
   private:
     // Forbidden constructor
     TwoOperand() = delete;
@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef VECTORWRITER_H
+#define VECTORWRITER_H
+
+#include "ioutputwriter.h"
+
+namespace as
+{
+
+/**
+ * @class VectorWriter
+ *
+ * @brief Write machine code as one std::vector initializer in a single header file.
+ *
+ * @details
+ * Each machine code word is written as a string literal followed by the
+ * assembler source line as comment (output format "vector").
+ */
+class VectorWriter : public IOutputWriter
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] configA Map of parameters from program configuration file.
+     */
+    VectorWriter(const boost::property_tree::ptree &configA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~VectorWriter(void) = default;
+
+    /**
+     * @brief Write machine code of an instruction stream to the output header.
+     *
+     * @throws AssemblerException if the output file cannot be opened.
+     *
+     * @param[in] streamA Assembled instruction stream.
+     * @param[in] outPathA Path to output header file.
+     * @return List with path of written header file.
+     */
+    virtual std::vector<boost::filesystem::path> write(const InstructionStream &streamA,
+                                                       const boost::filesystem::path &outPathA) override;
+};
+
+} /* End namespace as */
+
+#endif // VECTORWRITER_H
@@ -0,0 +1,86 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef WAITSINKING_H
+#define WAITSINKING_H
+
+#include "instructionset.h"
+#include "ipass.h"
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace as
+{
+
+/**
+ * @class WaitSinking
+ *
+ * @brief Move WAIT_READY behind instructions which do not depend on the running computation.
+ *
+ * @details
+ * While the VCGRA computes, the sequencer can load data into data input cache lines
+ * other than the selected one (LOADD, LOADDA) and configurations into processing element
+ * and channel configuration cache lines other than the selected ones (LOADPC, LOADCC).
+ * A WAIT_READY is moved down to the first instruction which is not such an independent load,
+ * e.g. a store from the data output cache, a line select or the next START.
+ * The computation uses the lines selected at its START, thus a load is compared with
+ * these lines, not with a selection changed after START. Loads into lines whose
+ * selection at START is unknown are treated as dependent.
+ */
+class WaitSinking : public IPass
+{
+  public:
+    /**
+     * @brief General constructor
+     *
+     * @param[in] isaA Instruction set to decode machine code words.
+     */
+    WaitSinking(const InstructionSet &isaA);
+
+    /**
+     * @brief Destructor
+     */
+    virtual ~WaitSinking(void) = default;
+
+    virtual std::string getName(void) const override final;
+
+    virtual uint64_t run(InstructionStream &streamA) override final;
+
+    virtual void report(std::ostream &osA) const override final;
+
+  private:
+    // Member
+    const InstructionSet &m_isa;
+    //!< @brief Instruction set to decode machine code words.
+    uint32_t m_start;
+    //!< @brief Machine code ID of START.
+    uint32_t m_wait;
+    //!< @brief Machine code ID of WAIT_READY.
+    std::array<uint32_t, 3> m_selectIds;
+    //!< @brief Machine code IDs of the select commands for DIC, PECC and CHCC.
+    std::array<uint32_t, 3> m_loadIds;
+    //!< @brief Machine code IDs of line loads into DIC, PC and CC.
+    uint32_t m_loadd;
+    //!< @brief Machine code ID of LOADD.
+    uint64_t m_hoisted;
+    //!< @brief Number of instructions moved in front of a WAIT_READY by last pass execution.
+};
+
+} /* End namespace as */
+
+#endif // WAITSINKING_H
@@ -0,0 +1,287 @@
+# Generated program: seed 1, depth 3, trips 5, body 12, loops 2, symbols 8, variables 4
+CONST c0 791776
+CONST c1 632124
+CONST c2 134100
+CONST c3 667212
+CONST c4 542448
+CONST c5 760818
+CONST c6 664456
+CONST c7 1048050
+VAR v0 241936
+VAR v1 1009808
+VAR v2 347872
+VAR v3 911206
+LOOP 0 5 1
+    VAR v0 241936
+    VAR v1 1009808
+    VAR v2 347872
+    VAR v3 911206
+    LOOP 0 5 1
+        VAR v0 241936
+        VAR v1 1009808
+        VAR v2 347872
+        VAR v3 911206
+        VAR v0 916126
+        LOADD c6 1 3
+        STOREDA c2 0
+        STOREDA v0 1
+        SLCT_DIC_LINE 0
+        LOOP 0 5 1
+            VAR v0 241936
+            VAR v1 1009808
+            VAR v2 347872
+            VAR v3 911206
+            STOREDA v0 0
+            MULI v0 2
+            LOADCC c6 0
+            LOADDA c5 0
+            SLCT_CHCC_LINE 1
+            VAR v2 988514
+            LOADCC v0 0
+            LOADD c2 1 7
+            LOADD v3 0 6
+            VAR v3 263506
+            SLCT_CHCC_LINE 1
+            SLCT_DOC_LINE 1
+        POOL
+        SLCT_PECC_LINE 0
+        LOOP 0 5 1
+            VAR v0 241936
+            VAR v1 1009808
+            VAR v2 347872
+            VAR v3 911206
+            START
+            VAR v0 235062
+            WAIT_READY
+            LOADPC v3 0
+            ADDI v0 38
+            ADDI v1 6
+            SLCT_PECC_LINE 0
+            STORED c3 1 3
+            LOADD v3 1 1
+            STORED c1 1 5
+            VAR v0 867726
+            ADDI v3 50
+            STORED c3 0 6
+        POOL
+        LOADD c4 1 4
+        ADDI v3 62
+        LOADD c3 0 7
+        START
+        WAIT_READY
+        VAR v0 830522
+    POOL
+    ADDI v2 44
+    STORED c7 0 7
+    LOADD v3 1 5
+    LOADD c7 1 1
+    ADDI v0 34
+    START
+    WAIT_READY
+    STORED c4 1 4
+    STORED v2 0 5
+    LOADD c6 0 3
+    STORED v3 1 4
+    START
+    WAIT_READY
+    LOOP 0 5 1
+        VAR v0 241936
+        VAR v1 1009808
+        VAR v2 347872
+        VAR v3 911206
+        LOADD c6 0 1
+        START
+        WAIT_READY
+        SLCT_PECC_LINE 1
+        ADDI v2 12
+        SLCT_PECC_LINE 0
+        STORED c4 0 5
+        ADDI v1 22
+        STORED c5 1 7
+        LOOP 0 5 1
+            VAR v0 241936
+            VAR v1 1009808
+            VAR v2 347872
+            VAR v3 911206
+            LOADD v2 1 5
+            NOOP
+            ADDI v3 56
+            STORED c1 0 7
+            START
+            NOOP
+            WAIT_READY
+            SLCT_CHCC_LINE 1
+            SLCT_DIC_LINE 0
+            STORED c5 0 6
+            VAR v3 211522
+            SLCT_CHCC_LINE 0
+            LOADD c3 1 5
+        POOL
+        STORED c0 1 0
+        LOADD v0 1 6
+        LOOP 0 5 1
+            VAR v0 241936
+            VAR v1 1009808
+            VAR v2 347872
+            VAR v3 911206
+            SLCT_PECC_LINE 0
+            LOADCC c3 0
+            LOADD v2 0 2
+            LOADD v0 0 0
+            LOADCC c0 1
+            VAR v0 245076
+            ADDI v0 48
+            VAR v2 931380
+            SLCT_PECC_LINE 0
+            VAR v0 977342
+            SLCT_DIC_LINE 1
+            START
+            WAIT_READY
+        POOL
+        LOADD v2 1 4
+        LOADD v3 0 2
+    POOL
+    ADDI v0 40
+POOL
+NOOP
+LOADD c3 1 2
+ADDI v3 56
+LOOP 0 5 1
+    VAR v0 241936
+    VAR v1 1009808
+    VAR v2 347872
+    VAR v3 911206
+    SLCT_DOC_LINE 1
+    LOADD c7 1 4
+    STORED v1 0 2
+    SLCT_PECC_LINE 1
+    START
+    WAIT_READY
+    LOOP 0 5 1
+        VAR v0 241936
+        VAR v1 1009808
+        VAR v2 347872
+        VAR v3 911206
+        SUBI v3 14
+        LOADD c7 0 5
+        NOOP
+        LOADD c2 0 7
+        ADDI v1 4
+        LOADD c5 1 0
+        ADDI v1 16
+        LOOP 0 5 1
+            VAR v0 241936
+            VAR v1 1009808
+            VAR v2 347872
+            VAR v3 911206
+            LOADD v2 1 7
+            LOADDA c3 1
+            ADDI v2 48
+            STORED c4 1 5
+            START
+            WAIT_READY
+            LOADCC v0 1
+            LOADCC c6 0
+            VAR v2 515146
+            LOADDA v1 1
+            LOADD c4 0 0
+            SLCT_CHCC_LINE 0
+            SLCT_DOC_LINE 0
+        POOL
+        LOADD c4 1 4
+        SLCT_CHCC_LINE 1
+        VAR v2 696478
+        LOOP 0 5 1
+            VAR v0 241936
+            VAR v1 1009808
+            VAR v2 347872
+            VAR v3 911206
+            LOADD c5 1 2
+            VAR v3 41054
+            VAR v0 276224
+            MULI v3 2
+            SLCT_DIC_LINE 0
+            SLCT_CHCC_LINE 1
+            LOADCC c6 1
+            LOADPC c0 1
+            SLCT_DIC_LINE 0
+            SLCT_DIC_LINE 0
+            ADDI v0 44
+            STORED c6 0 4
+        POOL
+        LOADDA c7 0
+        STORED c3 1 0
+    POOL
+    VAR v2 147782
+    VAR v2 149464
+    ADDI v1 46
+    LOOP 0 5 1
+        VAR v0 241936
+        VAR v1 1009808
+        VAR v2 347872
+        VAR v3 911206
+        ADDI v3 56
+        LOADCC c2 1
+        LOOP 0 5 1
+            VAR v0 241936
+            VAR v1 1009808
+            VAR v2 347872
+            VAR v3 911206
+            SLCT_DIC_LINE 0
+            LOADD v1 1 0
+            LOADD v3 1 0
+            STOREDA c0 1
+            LOADDA v1 1
+            ADDI v2 46
+            LOADDA c1 0
+            SLCT_DIC_LINE 0
+            SLCT_DOC_LINE 1
+            LOADDA c0 1
+            STORED v1 1 1
+            ADDI v2 16
+        POOL
+        SLCT_DOC_LINE 1
+        SLCT_PECC_LINE 0
+        LOADD c5 0 2
+        SUBI v2 22
+        STORED c4 1 5
+        LOOP 0 5 1
+            VAR v0 241936
+            VAR v1 1009808
+            VAR v2 347872
+            VAR v3 911206
+            SLCT_PECC_LINE 1
+            SLCT_DIC_LINE 1
+            STOREDA c2 0
+            LOADD c2 0 0
+            LOADD c1 0 2
+            LOADD c0 0 4
+            LOADD c5 1 0
+            LOADD c2 1 0
+            ADDI v1 24
+            LOADD c0 1 0
+            LOADD c6 1 5
+            SLCT_PECC_LINE 1
+        POOL
+        LOADD c4 0 1
+        ADDI v1 30
+        LOADD c0 1 6
+        SLCT_PECC_LINE 1
+        ADDI v3 4
+    POOL
+    VAR v1 372872
+    ADDI v3 42
+    LOADD c1 1 4
+    ADDI v3 24
+POOL
+LOADD c2 0 0
+VAR v1 164960
+SLCT_DOC_LINE 1
+LOADD c2 0 1
+STORED c1 1 7
+STORED c5 0 6
+STOREDA c1 0
+START
+STORED v0 0 5
+WAIT_READY
+FINISH
@@ -0,0 +1,87 @@
+# Generated program: seed 2, depth 2, trips 24, body 20, loops 1, symbols 8, variables 4
+CONST c0 271896
+CONST c1 323250
+CONST c2 953594
+CONST c3 276886
+CONST c4 1009992
+CONST c5 631690
+CONST c6 261794
+CONST c7 1030390
+VAR v0 850716
+VAR v1 550972
+VAR v2 106332
+VAR v3 369606
+LOADD c7 0 6
+LOADD c2 1 1
+ADDI v1 30
+ADDI v0 2
+STORED c0 0 3
+LOADD c3 0 3
+STORED c1 0 0
+LOOP 0 24 1
+    VAR v0 850716
+    VAR v1 550972
+    VAR v2 106332
+    VAR v3 369606
+    ADDI v1 38
+    LOADD v2 1 1
+    LOADD c3 0 5
+    SLCT_CHCC_LINE 1
+    LOADD v2 0 4
+    ADDI v3 34
+    ADDI v0 38
+    LOOP 0 24 1
+        VAR v0 850716
+        VAR v1 550972
+        VAR v2 106332
+        VAR v3 369606
+        STORED v3 1 6
+        ADD v0 v2
+        STORED v1 0 4
+        LOADDA v0 0
+        ADDI v0 46
+        LOADD c0 0 0
+        ADDI v1 20
+        STOREDA c3 0
+        LOADD v3 0 0
+        SLCT_DOC_LINE 0
+        STOREDA c3 1
+        LOADD v3 1 5
+        LOADD v3 0 0
+        LOADDA c4 0
+        VAR v2 180600
+        STORED c3 1 7
+        STORED c5 1 1
+        SLCT_PECC_LINE 1
+        VAR v3 423054
+        ADDI v0 2
+    POOL
+    MULI v3 2
+    SLCT_DIC_LINE 1
+    START
+    NOOP
+    WAIT_READY
+    STOREDA c2 0
+    LOADD v0 0 1
+    ADDI v1 38
+    LOADD c2 1 0
+    VAR v0 768004
+    VAR v3 771234
+    LOADD v0 0 0
+    LOADD c3 0 2
+    ADD v2 v1
+POOL
+STORED c3 1 7
+ADDI v2 6
+ADDI v0 20
+LOADD v0 1 0
+VAR v3 142066
+LOADD v3 1 5
+LOADD c6 1 7
+LOADD c6 0 7
+LOADD c3 1 5
+LOADD c0 1 3
+ADD v3 v1
+SUB v1 c1
+ADDI v2 54
+FINISH
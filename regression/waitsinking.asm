@@ -0,0 +1,11 @@
+# WAIT_READY must not sink below a load into the DIC line latched at START,
+# although another DIC line is selected while the computation runs.
+CONST a 0
+CONST b 64
+SLCT_DOC_LINE 0
+SLCT_DIC_LINE 0
+START
+SLCT_DIC_LINE 1
+WAIT_READY
+LOADDA b 0
+STOREDA a 0
@@ -0,0 +1,201 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "memoryassembler.h"
+#include "myException.h"
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/program_options.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+namespace fs = boost::filesystem;
+
+/**
+ * @brief Read a file into a string (the test reads files, the library does not).
+ *
+ * @param[in] pathA Path to file.
+ */
+std::string readFile(const fs::path &pathA)
+{
+    fs::ifstream t_is{pathA};
+
+    if (!t_is)
+        throw as::AssemblerException("Error while opening file: " + pathA.string(), 1202);
+
+    return std::string{std::istreambuf_iterator<char>{t_is}, std::istreambuf_iterator<char>{}};
+}
+
+/**
+ * @brief Compute FNV-1a hash of machine code words like the regression harness.
+ *
+ * @param[in] wordsA Machine code words.
+ */
+uint64_t hash(const std::vector<uint64_t> &wordsA)
+{
+    uint64_t t_hash{0xCBF29CE484222325};
+
+    for (const uint64_t word : wordsA)
+        for (uint32_t b = 0; b < 8; ++b)
+            {
+                t_hash ^= (word >> (8 * b)) & 0xFF;
+                t_hash *= 0x100000001B3;
+            }
+
+    return t_hash;
+}
+
+/**
+ * @brief Assemble a corpus case in memory and compare the hash with the golden hash.
+ *
+ * @param[in] lineA Corpus line "name program config hash [assembler options]".
+ * @param[in] corpusDirA Directory of corpus file.
+ * @return True, if the case passed.
+ */
+bool runCase(const std::string &lineA, const fs::path &corpusDirA)
+{
+    std::istringstream t_line{lineA};
+    std::string t_name{}, t_program{}, t_configFile{}, t_hash{}, t_opt{};
+    unsigned t_level{0};
+
+    t_line >> t_name >> t_program >> t_configFile >> t_hash;
+
+    // Output format options do not change the machine code words
+    while (t_line >> t_opt)
+        if (t_opt.compare(0, 2, "-O") == 0)
+            t_level = std::stoul(t_opt.substr(2));
+
+    try
+        {
+            as::MemoryAssembler t_as{as::MemoryAssembler::readConfig(readFile(corpusDirA / t_configFile))};
+            t_as.getConfig().put("General.Optimize", t_level);
+
+            const as::MemoryAssembler::Program t_result = t_as.assemble(readFile(corpusDirA / t_program));
+            const uint64_t t_golden = std::stoull(t_hash, nullptr, 16);
+            bool t_lines = t_result.lines.size() == t_result.words.size();
+
+            for (const uint64_t line : t_result.lines)
+                t_lines = t_lines && line != 0;
+
+            if (hash(t_result.words) != t_golden || !t_lines)
+                {
+                    std::cout << t_name << ": FAILED (" << t_result.words.size() << " words)" << std::endl;
+                    return false;
+                }
+        }
+    catch (const as::AssemblerException &e)
+        {
+            std::cout << t_name << ": FAILED (" << e.what() << ")" << std::endl;
+            return false;
+        }
+
+    std::cout << t_name << ": passed" << std::endl;
+
+    return true;
+}
+
+/**
+ * @brief Check that errors in the source are reported as exceptions with the source line.
+ *
+ * @param[in] configA Content of configuration file.
+ * @return True, if the check passed.
+ */
+bool runFaulty(const std::string &configA)
+{
+    try
+        {
+            as::MemoryAssembler t_as{as::MemoryAssembler::readConfig(configA)};
+            t_as.assemble("LOOP 0 4 0\nPOOL\n");
+        }
+    catch (const as::AssemblerException &)
+        {
+            std::cout << "faulty: passed" << std::endl;
+            return true;
+        }
+
+    std::cout << "faulty: FAILED (no exception)" << std::endl;
+
+    return false;
+}
+
+} // end of anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    namespace po = boost::program_options;
+    //!< @brief Abbreviation for boost program options library.
+
+    /* Define command line options for API test.
+       help: Shows cmd-tool options
+       corpus: Regression corpus file (hashes of the file based assembler).
+       config: Configuration file for faulty program check.
+     */
+    po::options_description desc("Usable options");
+    desc.add_options()("help,", "Show command line options and usability.")(
+        "corpus,", po::value<std::string>()->default_value("regression/corpus.txt"), "Regression corpus file.")(
+        "config,", po::value<std::string>()->default_value("regression/config.xml"), "Assembler configuration file.");
+
+    po::variables_map vm;
+    //!< \brief Variable map to store command line options.
+
+    try
+        {
+            po::store(po::parse_command_line(argc, argv, desc), vm);
+            po::notify(vm);
+        }
+    catch (const po::error &e)
+        {
+            std::cout << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    if (vm.count("help") != 0U)
+        {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+
+    const fs::path t_corpus{vm["corpus"].as<std::string>()};
+    uint32_t t_failed{0};
+
+    try
+        {
+            std::istringstream t_is{readFile(t_corpus)};
+            std::string t_line{};
+
+            while (std::getline(t_is, t_line))
+                if (!t_line.empty() && t_line[0] != '#' && !runCase(t_line, t_corpus.parent_path()))
+                    ++t_failed;
+
+            if (!runFaulty(readFile(vm["config"].as<std::string>())))
+                ++t_failed;
+        }
+    catch (const as::AssemblerException &e)
+        {
+            std::cout << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    return t_failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -18,7 +18,17 @@
 #include "assembler.h"
 #include "add.h"
 #include "addinteger.h"
+#include "confighoisting.h"
+#include "constexprwriter.h"
+#include "deadcodeelimination.h"
+#include "doublebuffering.h"
+#include "instructionset.h"
+#include "instrumentation.h"
+#include "latencymodel.h"
+#include "listscheduler.h"
+#include "loadcoalescing.h"
 #include "loop.h"
+#include "memoryprofiler.h"
 #include "mul.h"
 #include "mulinteger.h"
 #include "myException.h"
@@ -26,11 +36,20 @@
 #include "oneoperand.h"
 #include "parseobjectconst.h"
 #include "parseobjectvariable.h"
+#include "passmanager.h"
+#include "peephole.h"
+#include "performancemodel.h"
 #include "resetvariable.h"
+#include "selectelimination.h"
+#include "storecoalescing.h"
+#include "shardedwriter.h"
 #include "sub.h"
 #include "subinteger.h"
 #include "threeoperand.h"
+#include "tracer.h"
 #include "twooperand.h"
+#include "vectorwriter.h"
+#include "waitsinking.h"
 #include <boost/format.hpp>
 #include <boost/property_tree/exceptions.hpp>
 #include <boost/property_tree/ptree.hpp>
@@ -39,6 +58,7 @@
 #include <cstdint>
 #include <iostream>
 #include <locale>
+#include <memory>
 
 namespace
 {
@@ -101,12 +121,14 @@ bool is_number(const std::string &strA)
 typedef struct
 {
     std::array<std::string, 2> &Ops; //!< @brief Reference to array of operands
-    uint16_t &count;                 //!< @brief Reference to the line counter
+    uint64_t &count;                 //!< @brief Reference to the line counter
     std::string &command;            //!< @brief Reference to the command string
     const std::string &match;        //!< @brief reference to the line match string
     const uint8_t &machineId;        //!< @brief Reference to machine ID (unused for arithmetic operations)
     const char *const &op_type;      //!< @brief Reference to latest operator type
     boost::smatch &commandMatch;     //!< @brief Reference to match object for two operand commands
+    as::Logger &log;                 //!< @brief Reference to log output for created parse objects
+    as::Level *const &level;         //!< @brief Reference to active level of parser
 } createTwoOpParseObjParam_t;
 
 /**
@@ -125,7 +147,7 @@ as::ParseObjBase *createTwoOpParseObj(createTwoOpParseObjParam_t &paramA)
 
     for (const auto &op : paramA.Ops)
         {
-            auto t_op = as::Level::getCurrentLevel()->findParseObj(op);
+            auto t_op = paramA.level->findParseObj(op);
 
             if (!t_op)
                 {
@@ -139,9 +161,9 @@ as::ParseObjBase *createTwoOpParseObj(createTwoOpParseObjParam_t &paramA)
                     else
                         {
                             auto t_parseObj =
-                                new as::ParseObjectConst(op, std::stoi(op, nullptr, 0), as::Level::getCurrentLevel(),
+                                new as::ParseObjectConst(op, std::stoi(op, nullptr, 0), paramA.level,
                                                          paramA.commandMatch[0].str(), paramA.count);
-                            as::Level::getCurrentLevel()->addParseObj(t_parseObj);
+                            paramA.level->addParseObj(t_parseObj);
 
                             t_op = t_parseObj;
                         }
@@ -160,30 +182,30 @@ as::ParseObjBase *createTwoOpParseObj(createTwoOpParseObjParam_t &paramA)
 
     if (std::strcmp(paramA.op_type, "TwoOperator") == 0)
         {
-            t_parseObj = new as::TwoOperand(as::Level::getCurrentLevel(), paramA.match, paramA.count, t_first, t_second,
+            t_parseObj = new as::TwoOperand(paramA.level, paramA.match, paramA.count, t_first, t_second,
                                             paramA.machineId);
 
             // Show properties of variable for debugging
-            std::cout << *static_cast<as::TwoOperand *>(t_parseObj) << "\n";
+            CGRA_LOG(paramA.log, DEBUG) << *static_cast<as::TwoOperand *>(t_parseObj) << '\n';
         }
     else
         {
             if (std::strcmp(paramA.command.c_str(), "ADD") == 0)
                 {
                     t_parseObj =
-                        new as::Add(as::Level::getCurrentLevel(), paramA.match, paramA.count, t_first, t_second);
+                        new as::Add(paramA.level, paramA.match, paramA.count, t_first, t_second);
 
                     // Show properties of variable for debugging
-                    std::cout << *static_cast<as::Add *>(t_parseObj) << "\n";
+                    CGRA_LOG(paramA.log, DEBUG) << *static_cast<as::Add *>(t_parseObj) << '\n';
                 }
             else if (std::strcmp(paramA.command.c_str(), "ADDI") == 0)
                 {
                     if (t_second->getCommandClass() == as::COMMANDCLASS::CONSTANT)
                         {
-                            t_parseObj = new as::AddInteger(as::Level::getCurrentLevel(), paramA.match, paramA.count,
+                            t_parseObj = new as::AddInteger(paramA.level, paramA.match, paramA.count,
                                                             t_first, t_second);
                             // Show properties of variable for debugging
-                            std::cout << *static_cast<as::AddInteger *>(t_parseObj) << "\n";
+                            CGRA_LOG(paramA.log, DEBUG) << *static_cast<as::AddInteger *>(t_parseObj) << '\n';
                         }
                     else
                         {
@@ -196,19 +218,19 @@ as::ParseObjBase *createTwoOpParseObj(createTwoOpParseObjParam_t &paramA)
             else if (std::strcmp(paramA.command.c_str(), "SUB") == 0)
                 {
                     t_parseObj =
-                        new as::Sub(as::Level::getCurrentLevel(), paramA.match, paramA.count, t_first, t_second);
+                        new as::Sub(paramA.level, paramA.match, paramA.count, t_first, t_second);
 
                     // Show properties of variable for debugging
-                    std::cout << *static_cast<as::Sub *>(t_parseObj) << "\n";
+                    CGRA_LOG(paramA.log, DEBUG) << *static_cast<as::Sub *>(t_parseObj) << '\n';
                 }
             else if (std::strcmp(paramA.command.c_str(), "SUBI") == 0)
                 {
                     if (t_second->getCommandClass() == as::COMMANDCLASS::CONSTANT)
                         {
-                            t_parseObj = new as::SubInteger(as::Level::getCurrentLevel(), paramA.match, paramA.count,
+                            t_parseObj = new as::SubInteger(paramA.level, paramA.match, paramA.count,
                                                             t_first, t_second);
                             // Show properties of variable for debugging
-                            std::cout << *static_cast<as::SubInteger *>(t_parseObj) << "\n";
+                            CGRA_LOG(paramA.log, DEBUG) << *static_cast<as::SubInteger *>(t_parseObj) << '\n';
                         }
                     else
                         {
@@ -221,19 +243,19 @@ as::ParseObjBase *createTwoOpParseObj(createTwoOpParseObjParam_t &paramA)
             else if (std::strcmp(paramA.command.c_str(), "MUL") == 0)
                 {
                     t_parseObj =
-                        new as::Mul(as::Level::getCurrentLevel(), paramA.match, paramA.count, t_first, t_second);
+                        new as::Mul(paramA.level, paramA.match, paramA.count, t_first, t_second);
 
                     // Show properties of variable for debugging
-                    std::cout << *static_cast<as::Mul *>(t_parseObj) << "\n";
+                    CGRA_LOG(paramA.log, DEBUG) << *static_cast<as::Mul *>(t_parseObj) << '\n';
                 }
             else if (std::strcmp(paramA.command.c_str(), "MULI") == 0)
                 {
                     if (t_second->getCommandClass() == as::COMMANDCLASS::CONSTANT)
                         {
-                            t_parseObj = new as::MulInteger(as::Level::getCurrentLevel(), paramA.match, paramA.count,
+                            t_parseObj = new as::MulInteger(paramA.level, paramA.match, paramA.count,
                                                             t_first, t_second);
                             // Show properties of variable for debugging
-                            std::cout << *static_cast<as::MulInteger *>(t_parseObj) << "\n";
+                            CGRA_LOG(paramA.log, DEBUG) << *static_cast<as::MulInteger *>(t_parseObj) << '\n';
                         }
                     else
                         {
@@ -253,13 +275,45 @@ as::ParseObjBase *createTwoOpParseObj(createTwoOpParseObjParam_t &paramA)
     return t_parseObj;
 }
 
+/**
+ * @brief Check that format is a supported output format.
+ *
+ * @param formatA Name of output format.
+ * @return True if an output writer for the format exists.
+ */
+bool isOutputFormat(const std::string &formatA)
+{
+    return formatA == "vector" || formatA == "sharded" || formatA == "constexpr";
+}
+
+/**
+ * @brief Create output writer for an output format.
+ *
+ * @param formatA Name of output format.
+ * @param configA Map of parameters from program configuration file.
+ * @return Output writer for selected format.
+ */
+as::IOutputWriter *createWriter(const std::string &formatA, const boost::property_tree::ptree &configA)
+{
+    if (formatA == "sharded")
+        return new as::ShardedWriter(configA);
+    else if (formatA == "constexpr")
+        return new as::ConstexprWriter(configA);
+    else if (formatA == "vector")
+        return new as::VectorWriter(configA);
+    else
+        throw as::AssemblerException("Unknown output format \"" + formatA + "\".", 1003);
+}
+
 } // End anonymous namespace
 
 namespace as
 {
 
 Assembler::Assembler(boost::filesystem::path &filePathA, boost::property_tree::ptree &configA, std::ostream &logA)
-    : m_filePath(filePathA), m_config(configA), m_log(logA), m_firstLevel{new Level()}
+    : m_filePath(filePathA), m_config(configA),
+      m_log(logA, Logger::toLevel(configA.get<std::string>("General.LogLevel", "info"))), m_firstLevel{new Level()},
+      m_currentLevel{m_firstLevel}
 {
 
     try
@@ -273,13 +327,13 @@ Assembler::Assembler(boost::filesystem::path &filePathA, boost::property_tree::p
         }
 
     if (boost::filesystem::exists(m_outPath))
-        m_log << "Warning: File" << m_outPath.filename() << " will be replaced." << std::endl;
+        CGRA_LOG(m_log, WARN) << "Warning: File" << m_outPath.filename() << " will be replaced." << std::endl;
     else
         {
             if (m_outPath.parent_path().string() != ".")
                 {
                     if (boost::filesystem::create_directories(m_outPath.parent_path()))
-                        m_log << "Info: Create output file directory." << std::endl;
+                        CGRA_LOG(m_log, INFO) << "Info: Create output file directory." << std::endl;
                 }
         }
 
@@ -289,7 +343,22 @@ Assembler::Assembler(boost::filesystem::path &filePathA, boost::property_tree::p
     if (m_outFileName.extension() != ".hpp")
         throw as::AssemblerException("Output file has wrong file extension. Expected extension \".vmc\"", 1001);
 
-    Level::setCurrentLevel(m_firstLevel);
+    // Validate output format
+    m_format = m_config.get<std::string>("General.Format", "vector");
+    if (!isOutputFormat(m_format))
+        throw as::AssemblerException("Unknown output format \"" + m_format + "\" in configuration file.", 1003);
+
+    readOptions();
+
+    return;
+}
+
+Assembler::Assembler(const boost::property_tree::ptree &configA, std::ostream &logA)
+    : m_filePath{}, m_config(configA),
+      m_log(logA, Logger::toLevel(configA.get<std::string>("General.LogLevel", "info"))), m_firstLevel{new Level()},
+      m_currentLevel{m_firstLevel}
+{
+    readOptions();
 
     return;
 }
@@ -299,10 +368,42 @@ Assembler::~Assembler()
     delete m_firstLevel;
 }
 
+void Assembler::readOptions(void)
+{
+    // Optimization level (0 = no optimization)
+    m_optLevel = m_config.get<unsigned>("General.Optimize", 0);
+
+    // Estimate execution cycles of loops (default=false)
+    m_profile = m_config.get<bool>("General.Profile", false);
+
+    // Report memory traffic and data reuse of machine code (default=false)
+    m_memoryProfile = m_config.get<bool>("General.MemoryProfile", false);
+
+    return;
+}
+
 void Assembler::parse(void)
 {
-    m_log << "Start parsing assembler file" << std::endl;
-    m_log << "----------------------------" << std::endl;
+    // Open file
+    std::filebuf t_fb;
+    if (t_fb.open(m_filePath.c_str(), std::ios::in))
+        {
+            std::istream t_is(&t_fb);
+            parse(t_is);
+        }
+    else
+        throw as::AssemblerException("Error while opening assembler source file for parsing", 1202);
+
+    return;
+}
+
+void Assembler::parse(std::istream &isA)
+{
+    Instrumentation::Timer t_timer{"parse"};
+    CGRA_TRACE_SPAN("parse", "phase");
+
+    CGRA_LOG(m_log, INFO) << "Start parsing assembler file" << std::endl;
+    CGRA_LOG(m_log, INFO) << "----------------------------" << std::endl;
 
     // Load list of available operations and there machine ID from configuration file
     std::unordered_map<std::string, std::vector<std::pair<std::string, uint8_t>>> t_commandMap{};
@@ -324,36 +425,41 @@ void Assembler::parse(void)
                     t_commandMap.emplace(iter.substr(iter.find_first_of('.') + 1), std::move(t_vec));
                 }
 
-            m_log << "Available commands: " << '\n';
-            m_log << "====================" << '\n';
+            if (m_log.isEnabled(Logger::LEVEL::DEBUG))
+                {
+                    m_log.stream() << "Available commands: " << '\n';
+                    m_log.stream() << "====================" << '\n';
 
-            for (const auto &iter : t_commandMap)
-                for (const auto &com : iter.second)
-                    m_log << com.first << ",";
+                    for (const auto &iter : t_commandMap)
+                        for (const auto &com : iter.second)
+                            m_log.stream() << com.first << ",";
 
-            m_log << "\n\n\n" << std::endl;
+                    m_log.stream() << "\n\n\n" << std::endl;
+                }
         }
     catch (boost::property_tree::ptree_error &e)
         {
-            std::cerr << e.what() << std::endl;
+            CGRA_LOG(m_log, ERROR) << e.what() << std::endl;
         }
 
-    // Open file
-    std::filebuf t_fb;
-    if (t_fb.open(m_filePath.c_str(), std::ios::in))
+    // Read source
+    if (isA)
         {
             // Temporary variables to handle lines of file
-            std::istream t_is(&t_fb);
+            std::istream &t_is = isA;
             std::string t_str;
-            uint16_t t_count{1};
+            uint64_t t_count{1};
             boost::smatch t_LineMatch;
 
             // Iterate over file lines:
             do
                 {
                     std::getline(t_is, t_str);
+                    Instrumentation::count(Instrumentation::COUNTER::LINES);
+                    CGRA_TRACE_SPAN("statement", "parse");
+                    CGRA_TRACE_ARG("line", t_count);
 
-                    m_log << "Parsed Assembler line " << t_count << ": " << t_str << std::endl;
+                    CGRA_LOG(m_log, TRACE) << "Parsed Assembler line " << t_count << ": " << t_str << '\n';
 
                     if (t_str.find_first_of('#') != std::string::npos || t_str.empty()) // Comment or empty line
                         {
@@ -375,7 +481,7 @@ void Assembler::parse(void)
                                     if (is_number(t_LineMatch[t_countval].str()))
                                         {
                                             auto t_searchResult =
-                                                Level::getCurrentLevel()->findParseObj(t_LineMatch[t_countval].str());
+                                                m_currentLevel->findParseObj(t_LineMatch[t_countval].str());
 
                                             if (t_searchResult)
                                                 {
@@ -385,17 +491,17 @@ void Assembler::parse(void)
                                                 {
                                                     auto t_val = stoi(t_LineMatch[t_countval], nullptr, 0);
                                                     auto t_pConst = new ParseObjectConst(t_LineMatch[t_countval], t_val,
-                                                                                         Level::getCurrentLevel(),
+                                                                                         m_currentLevel,
                                                                                          t_LineMatch[0], t_count);
 
-                                                    Level::getCurrentLevel()->addParseObj(t_pConst);
+                                                    m_currentLevel->addParseObj(t_pConst);
                                                     *val = t_pConst;
                                                 }
                                         }
                                     else
                                         {
                                             auto t_searchResult =
-                                                Level::getCurrentLevel()->findParseObj(t_LineMatch[t_countval].str());
+                                                m_currentLevel->findParseObj(t_LineMatch[t_countval].str());
                                             if (t_searchResult)
                                                 {
                                                     if (t_searchResult->getCommandClass() == COMMANDCLASS::VARIABLE ||
@@ -422,23 +528,23 @@ void Assembler::parse(void)
                                                              1066);
 
                             // Add Loop start point to actual level
-                            auto t_pObj = new ParseObjBase(Level::getCurrentLevel(), COMMANDCLASS::LOOP,
+                            auto t_pObj = new ParseObjBase(m_currentLevel, COMMANDCLASS::LOOP,
                                                            t_LineMatch[0].str(), t_count);
-                            Level::getCurrentLevel()->addParseObj(t_pObj);
+                            m_currentLevel->addParseObj(t_pObj);
 
                             // Create new level as a loop
-                            Loop *t_loopPtr = new Loop(Loop::getCurrentLevel(), t_count, t_start, t_end, t_step,
+                            Loop *t_loopPtr = new Loop(m_currentLevel, t_count, t_start, t_end, t_step,
                                                        t_LineMatch[0].str());
-                            Level::getCurrentLevel()->addChildLevel(static_cast<Level *>(t_loopPtr));
+                            m_currentLevel->addChildLevel(static_cast<Level *>(t_loopPtr));
 
                             // Set actual level to new created loop
-                            Level::setCurrentLevel(static_cast<Level *>(t_loopPtr));
+                            m_currentLevel = static_cast<Level *>(t_loopPtr);
 
                             ++t_count;
                         }
                     else if (boost::regex_search(t_str, t_LineMatch, c_ePool))
                         {
-                            Level::getCurrentLevel()->leave();
+                            m_currentLevel = m_currentLevel->leave();
                             ++t_count;
                         }
                     else if (boost::regex_search(t_str, t_LineMatch, c_eVariable))
@@ -461,7 +567,7 @@ void Assembler::parse(void)
                             else
                                 {
 
-                                    auto t_valPtr = Level::getCurrentLevel()->findParseObj(t_LineMatch[2].str());
+                                    auto t_valPtr = m_currentLevel->findParseObj(t_LineMatch[2].str());
                                     if (t_valPtr)
                                         {
                                             if (t_valPtr->getCommandClass() == COMMANDCLASS::VARIABLE)
@@ -486,17 +592,17 @@ void Assembler::parse(void)
                                         }
                                 }
 
-                            auto t_var = as::Level::getCurrentLevel()->findParseObj(t_LineMatch[1].str());
+                            auto t_var = m_currentLevel->findParseObj(t_LineMatch[1].str());
                             as::ParseObjBase *t_pvPtr{nullptr};
 
                             if (t_var)
                                 {
-                                    auto t_valPtr = Level::getCurrentLevel()->findParseObj(t_LineMatch[2].str());
+                                    auto t_valPtr = m_currentLevel->findParseObj(t_LineMatch[2].str());
 
                                     if (t_valPtr)
                                         {
                                             t_pvPtr = static_cast<as::ParseObjBase *>(
-                                                new ResetVariable(Level::getCurrentLevel(), t_LineMatch[0].str(),
+                                                new ResetVariable(m_currentLevel, t_LineMatch[0].str(),
                                                                   t_count, t_valPtr, t_var));
                                         }
                                     else
@@ -506,17 +612,17 @@ void Assembler::parse(void)
                                                     t_value = std::stoi(t_LineMatch[2].str(), nullptr, 0);
 
                                                     auto t_pcPtr = new ParseObjectConst(t_LineMatch[2].str(), t_value,
-                                                                                        Level::getCurrentLevel(),
+                                                                                        m_currentLevel,
                                                                                         t_LineMatch[0].str(), t_count);
 
                                                     // At parse object to current level
-                                                    Level::getCurrentLevel()->addParseObj(t_pcPtr);
+                                                    m_currentLevel->addParseObj(t_pcPtr);
 
                                                     // Show properties of variable for debugging
-                                                    std::cout << *t_pcPtr << "\n";
+                                                    CGRA_LOG(m_log, DEBUG) << *t_pcPtr << '\n';
 
                                                     t_pvPtr = static_cast<as::ParseObjBase *>(new ResetVariable(
-                                                        Level::getCurrentLevel(), t_LineMatch[0].str(), t_count,
+                                                        m_currentLevel, t_LineMatch[0].str(), t_count,
                                                         t_pcPtr, t_var));
                                                 }
                                             else
@@ -531,15 +637,15 @@ void Assembler::parse(void)
                             else
                                 {
                                     t_pvPtr = static_cast<as::ParseObjBase *>(
-                                        new ParseObjectVariable(t_LineMatch[1].str(), t_value, Level::getCurrentLevel(),
+                                        new ParseObjectVariable(t_LineMatch[1].str(), t_value, m_currentLevel,
                                                                 t_LineMatch[0].str(), t_count));
                                 }
 
                             // At parse object to current level
-                            Level::getCurrentLevel()->addParseObj(t_pvPtr);
+                            m_currentLevel->addParseObj(t_pvPtr);
 
                             // Show properties of variable for debugging
-                            std::cout << *t_pvPtr << "\n";
+                            CGRA_LOG(m_log, DEBUG) << *t_pvPtr << '\n';
 
                             ++t_count;
                         }
@@ -568,14 +674,14 @@ void Assembler::parse(void)
                                     throw AssemblerException(t_msg.str(), 1026);
                                 }
 
-                            auto t_pcPtr = new ParseObjectConst(t_LineMatch[1].str(), t_value, Level::getCurrentLevel(),
+                            auto t_pcPtr = new ParseObjectConst(t_LineMatch[1].str(), t_value, m_currentLevel,
                                                                 t_LineMatch[0].str(), t_count);
 
                             // At parse object to current level
-                            Level::getCurrentLevel()->addParseObj(t_pcPtr);
+                            m_currentLevel->addParseObj(t_pcPtr);
 
                             // Show properties of variable for debugging
-                            std::cout << *t_pcPtr << "\n";
+                            CGRA_LOG(m_log, DEBUG) << *t_pcPtr << '\n';
 
                             ++t_count;
                         }
@@ -608,7 +714,7 @@ void Assembler::parse(void)
 
                                                     for (const auto &op : t_Ops)
                                                         {
-                                                            auto t_op = as::Level::getCurrentLevel()->findParseObj(op);
+                                                            auto t_op = m_currentLevel->findParseObj(op);
 
                                                             if (!t_op)
                                                                 {
@@ -626,9 +732,9 @@ void Assembler::parse(void)
                                                                         {
                                                                             auto t_parseObj = new as::ParseObjectConst(
                                                                                 op, std::stoi(op, nullptr, 0),
-                                                                                as::Level::getCurrentLevel(),
+                                                                                m_currentLevel,
                                                                                 t_commandMatch[0].str(), t_count);
-                                                                            as::Level::getCurrentLevel()->addParseObj(
+                                                                            m_currentLevel->addParseObj(
                                                                                 t_parseObj);
 
                                                                             t_op = t_parseObj;
@@ -652,14 +758,14 @@ void Assembler::parse(void)
                                                         }
 
                                                     auto t_parseObj = new as::ThreeOperand(
-                                                        as::Level::getCurrentLevel(), t_match, t_count, t_first,
+                                                        m_currentLevel, t_match, t_count, t_first,
                                                         t_second, t_third, vec.second);
 
                                                     // At parse object to current level
-                                                    as::Level::getCurrentLevel()->addParseObj(t_parseObj);
+                                                    m_currentLevel->addParseObj(t_parseObj);
 
                                                     // Show properties of variable for debugging
-                                                    std::cout << *t_parseObj << "\n";
+                                                    CGRA_LOG(m_log, DEBUG) << *t_parseObj << '\n';
 
                                                     break;
                                                 }
@@ -690,13 +796,15 @@ void Assembler::parse(void)
                                                                         .machineId = vec.second,
                                                                         .op_type = op_type,
                                                                         .commandMatch = t_commandMatch,
+                                                                        .log = m_log,
+                                                                        .level = m_currentLevel,
                                                                     };
 
                                                                     as::ParseObjBase *t_parseObj =
                                                                         createTwoOpParseObj(t_param);
 
                                                                     // At parse object to current level
-                                                                    as::Level::getCurrentLevel()->addParseObj(
+                                                                    m_currentLevel->addParseObj(
                                                                         t_parseObj);
 
                                                                     found = true;
@@ -720,7 +828,7 @@ void Assembler::parse(void)
                                         {
                                             if (vec.first == t_command)
                                                 {
-                                                    auto t_first = as::Level::getCurrentLevel()->findParseObj(t_value);
+                                                    auto t_first = m_currentLevel->findParseObj(t_value);
 
                                                     if (!t_first)
                                                         {
@@ -738,23 +846,23 @@ void Assembler::parse(void)
                                                                 {
                                                                     auto t_parseObj = new as::ParseObjectConst(
                                                                         t_value, std::stoi(t_value, nullptr, 0),
-                                                                        as::Level::getCurrentLevel(),
+                                                                        m_currentLevel,
                                                                         t_commandMatch[0].str(), t_count);
-                                                                    as::Level::getCurrentLevel()->addParseObj(
+                                                                    m_currentLevel->addParseObj(
                                                                         t_parseObj);
                                                                     t_first = t_parseObj;
                                                                 }
                                                         }
 
                                                     auto t_parseObj =
-                                                        new as::OneOperand(as::Level::getCurrentLevel(), t_match,
+                                                        new as::OneOperand(m_currentLevel, t_match,
                                                                            t_count, t_first, vec.second);
 
                                                     // At parse object to current level
-                                                    as::Level::getCurrentLevel()->addParseObj(t_parseObj);
+                                                    m_currentLevel->addParseObj(t_parseObj);
 
                                                     // Show properties of variable for debugging
-                                                    std::cout << *t_parseObj << "\n";
+                                                    CGRA_LOG(m_log, DEBUG) << *t_parseObj << '\n';
 
                                                     break;
                                                 }
@@ -766,14 +874,14 @@ void Assembler::parse(void)
                                         {
                                             if (vec.first == t_match)
                                                 {
-                                                    auto t_parseObj = new NoOperand(Level::getCurrentLevel(), t_match,
+                                                    auto t_parseObj = new NoOperand(m_currentLevel, t_match,
                                                                                     t_count, vec.second);
 
                                                     // At parse object to current level
-                                                    Level::getCurrentLevel()->addParseObj(t_parseObj);
+                                                    m_currentLevel->addParseObj(t_parseObj);
 
                                                     // Show properties of variable for debugging
-                                                    std::cout << *t_parseObj << "\n";
+                                                    CGRA_LOG(m_log, DEBUG) << *t_parseObj << '\n';
 
                                                     break;
                                                 }
@@ -792,87 +900,155 @@ void Assembler::parse(void)
             while (!t_is.eof());
         }
     else
-        throw as::AssemblerException("Error while opening assembler source file for parsing", 1202);
+        throw as::AssemblerException("Error while reading assembler source for parsing", 1202);
 
-    m_log << "Parsing of assembler input file successfully finished." << std::endl;
+    CGRA_LOG(m_log, INFO) << "Parsing of assembler input file successfully finished." << std::endl;
 
     return;
 }
 
 void Assembler::assemble(void)
 {
-    m_log << "\nStart assembling code" << std::endl;
-    m_log << "---------------------" << std::endl;
+    if (m_outPath.empty())
+        throw as::AssemblerException("Assembler without output file cannot write machine code.", 1004);
 
-    // Opening file to store machine code.
-    std::filebuf t_fb;
+    compile();
+
+    // Store machine code with writer of selected output format
+    Instrumentation::Timer t_writeTimer{"write"};
+    std::unique_ptr<IOutputWriter> t_writer{createWriter(m_format, m_config)};
 
-    if (t_fb.open(m_outPath.c_str(), std::ios::out))
+    for (const auto &file : t_writer->write(m_stream, m_outPath))
+        CGRA_LOG(m_log, INFO) << "Machine operation code successfully stored at " << file << std::endl;
+
+    return;
+}
+
+const InstructionStream &Assembler::compile(void)
+{
+    Instrumentation::Timer t_timer{"assemble"};
+    CGRA_TRACE_SPAN("assemble", "phase");
+
+    CGRA_LOG(m_log, INFO) << "\nStart assembling code" << std::endl;
+    CGRA_LOG(m_log, INFO) << "---------------------" << std::endl;
+
+    // Register optimization passes of the selected level
+    PassManager t_passes{m_config, m_optLevel};
+
+    if (t_passes.getLevel() > 0)
         {
-            std::ostream t_codeFile(&t_fb);
+            const InstructionSet &t_isa = t_passes.getInstructionSet();
+
+            t_passes.addPass(1, new ConfigHoisting(t_isa));
+            t_passes.addPass(1, new DeadCodeElimination());
+            t_passes.addPass(1, new LoadCoalescing(t_isa, m_config));
+            t_passes.addPass(1, new StoreCoalescing(t_isa, m_config));
+            t_passes.addPass(2, new DoubleBuffering(t_isa, m_config));
+            t_passes.addPass(2, new WaitSinking(t_isa));
+            t_passes.addPass(2, new ListScheduler(t_isa, m_config));
+            t_passes.addPass(1, new Peephole(t_isa, m_config, t_passes.getLevel()));
+            t_passes.addPass(1, new SelectElimination(t_isa));
+        }
 
-            t_codeFile << "#ifndef " << std::uppercase << m_outFileName.stem().string() << "_H_\n";
-            t_codeFile << "#define " << std::uppercase << m_outFileName.stem().string() << "_H_\n\n\n";
+    // Optimizations on parsed levels
+    {
+        Instrumentation::Timer t_optTimer{"optimize-levels"};
+        t_passes.run(m_firstLevel);
+    }
 
-            t_codeFile << "#include <vector>\n\n";
-            t_codeFile << "namespace cgra \n{\n\n";
-            t_codeFile << "std::vector<cgra::TopLevel::assembler_type_t> assembly{\n";
+    // Performance estimation of loops without unrolling
+    std::unique_ptr<InstructionSet> t_isa{};
 
-            uint64_t lvlId{0};
+    if (m_profile)
+        {
+            t_isa.reset(new InstructionSet(m_config));
+            PerformanceModel t_perf{*t_isa, m_config};
+
+            const uint64_t t_cycles = t_perf.run(m_firstLevel);
 
-            for (auto po : m_firstLevel->getParseObjList())
+            if (m_log.isEnabled(Logger::LEVEL::INFO))
                 {
-                    switch (po->getCommandClass())
-                        {
-                        case as::COMMANDCLASS::ARITHMETIC:
-                            static_cast<as::IArithmetic *>(po)->processOperation();
-                            break;
-                        case as::COMMANDCLASS::NOOPERAND:
-                            t_codeFile << static_cast<as::NoOperand *>(po)->assemble(m_config);
-                            t_codeFile << ",";
-                            t_codeFile << " //" << po->getReadCmdLine() << std::endl;
-                            break;
-                        case as::COMMANDCLASS::ONEOPERAND:
-                            t_codeFile << static_cast<as::OneOperand *>(po)->assemble(m_config);
-                            t_codeFile << ",";
-                            t_codeFile << " //" << po->getReadCmdLine() << std::endl;
-                            break;
-                        case as::COMMANDCLASS::TWOOPERAND:
-                            t_codeFile << static_cast<as::TwoOperand *>(po)->assemble(m_config);
-                            t_codeFile << ",";
-                            t_codeFile << " //" << po->getReadCmdLine() << std::endl;
-                            break;
-                        case as::COMMANDCLASS::THREEOPERAND:
-                            t_codeFile << static_cast<as::ThreeOperand *>(po)->assemble(m_config);
-                            t_codeFile << ",";
-                            t_codeFile << " //" << po->getReadCmdLine() << std::endl;
-                            break;
-                        case as::COMMANDCLASS::LOOP:
-                            static_cast<Loop *>(m_firstLevel->at(lvlId++))->assemble(m_config, t_codeFile);
-                            break;
-                        case as::COMMANDCLASS::RESETVAR:
-                            static_cast<ResetVariable *>(po)->resetVariable();
-                            break;
-                        case as::COMMANDCLASS::CONSTANT:
-                        case as::COMMANDCLASS::VARIABLE:
-                        default:
-                            break;
-                        }
+                    m_log.stream() << "Estimated cycles of program: " << t_cycles << std::endl;
+                    t_perf.report(m_log.stream());
                 }
+        }
 
-            t_codeFile << "};\n\n";
-            t_codeFile << "} //End namespace cgra\n\n";
-            t_codeFile << "#endif //" << std::uppercase << m_outFileName.stem().string() << "_H_\n";
-            t_fb.close();
+    // Unroll parsed levels into instruction stream
+    {
+        Instrumentation::Timer t_lowerTimer{"lowering"};
+
+        m_stream.clear();
+
+        uint64_t lvlId{0};
+
+        for (auto po : m_firstLevel->getParseObjList())
+            {
+                switch (po->getCommandClass())
+                    {
+                    case as::COMMANDCLASS::ARITHMETIC:
+                        static_cast<as::IArithmetic *>(po)->processOperation();
+                        break;
+                    case as::COMMANDCLASS::NOOPERAND:
+                        m_stream.append(static_cast<as::NoOperand *>(po)->encode(m_config), po, nullptr);
+                        break;
+                    case as::COMMANDCLASS::ONEOPERAND:
+                        m_stream.append(static_cast<as::OneOperand *>(po)->encode(m_config), po, nullptr);
+                        break;
+                    case as::COMMANDCLASS::TWOOPERAND:
+                        m_stream.append(static_cast<as::TwoOperand *>(po)->encode(m_config), po, nullptr);
+                        break;
+                    case as::COMMANDCLASS::THREEOPERAND:
+                        m_stream.append(static_cast<as::ThreeOperand *>(po)->encode(m_config), po, nullptr);
+                        break;
+                    case as::COMMANDCLASS::LOOP:
+                        static_cast<Loop *>(m_firstLevel->at(lvlId++))->assemble(m_config, m_stream);
+                        break;
+                    case as::COMMANDCLASS::RESETVAR:
+                        static_cast<ResetVariable *>(po)->resetVariable();
+                        break;
+                    case as::COMMANDCLASS::CONSTANT:
+                    case as::COMMANDCLASS::VARIABLE:
+                    default:
+                        break;
+                    }
+            }
+    }
+
+    Instrumentation::count(Instrumentation::COUNTER::WORDS_UNROLLED, m_stream.size());
+
+    CGRA_LOG(m_log, INFO) << "Number of machine code words: " << m_stream.size() << std::endl;
+
+    // Optimizations on instruction stream
+    if (t_passes.getLevel() > 0)
+        {
+            {
+                Instrumentation::Timer t_optTimer{"optimize-stream"};
+                t_passes.run(m_stream);
+            }
+            if (m_log.isEnabled(Logger::LEVEL::INFO))
+                t_passes.report(m_log.stream());
+
+            CGRA_LOG(m_log, INFO) << "Number of optimized machine code words: " << m_stream.size() << std::endl;
         }
-    else
+
+    if (m_profile)
+        CGRA_LOG(m_log, INFO) << "Estimated cycles of machine code: "
+                              << LatencyModel(*t_isa, m_config).estimate(m_stream.getInstructions()) << std::endl;
+
+    if (m_memoryProfile)
         {
-            throw AssemblerException("Error while opening output file.", 4500);
+            if (!t_isa)
+                t_isa.reset(new InstructionSet(m_config));
+
+            MemoryProfiler t_memory{*t_isa, m_config};
+            t_memory.run(m_stream);
+            if (m_log.isEnabled(Logger::LEVEL::INFO))
+                t_memory.report(m_log.stream());
         }
 
-    m_log << "Machine operation code successfully stored at " << m_outPath << std::endl;
+    Instrumentation::count(Instrumentation::COUNTER::WORDS_EMITTED, m_stream.size());
 
-    return;
+    return m_stream;
 }
 
 // void Assembler::writeVmcFile()
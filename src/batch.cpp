@@ -0,0 +1,220 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "batch.h"
+#include "assembler.h"
+#include "instrumentation.h"
+#include "myException.h"
+#include "tracer.h"
+#include <algorithm>
+#include <boost/filesystem/fstream.hpp>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <thread>
+
+namespace as
+{
+
+Batch::Batch(const boost::property_tree::ptree &configA, const unsigned threadsA)
+    : m_config(configA), m_threads{threadsA}, m_outDir{}, m_jobs{}
+{
+    if (m_threads == 0)
+        m_threads = std::max(1U, std::thread::hardware_concurrency());
+
+    m_outDir = boost::filesystem::path{m_config.get<std::string>("General.Output", "./Assembler.hpp")}.parent_path();
+
+    if (m_outDir.empty())
+        m_outDir = ".";
+
+    return;
+}
+
+void Batch::add(const boost::filesystem::path &fileA)
+{
+    const auto t_output = m_outDir / (fileA.stem().string() + ".hpp");
+
+    for (const auto &job : m_jobs)
+        if (job.output == t_output)
+            throw AssemblerException("Batch: Files " + job.file.string() + " and " + fileA.string() +
+                                         " write to the same output file " + t_output.string() + ".",
+                                     1017);
+
+    m_jobs.push_back(Job{fileA, t_output, false, "", 0.0});
+
+    return;
+}
+
+void Batch::readManifest(const boost::filesystem::path &manifestA)
+{
+    boost::filesystem::ifstream t_is{manifestA};
+
+    if (!t_is)
+        throw AssemblerException("Batch: Cannot read manifest " + manifestA.string(), 1017);
+
+    std::string t_line{};
+
+    while (std::getline(t_is, t_line))
+        {
+            // Strip surrounding white space
+            const auto t_begin = t_line.find_first_not_of(" \t\r");
+            const auto t_end = t_line.find_last_not_of(" \t\r");
+
+            if (t_begin == std::string::npos || t_line[t_begin] == '#')
+                continue;
+
+            boost::filesystem::path t_file{t_line.substr(t_begin, t_end - t_begin + 1)};
+
+            if (t_file.is_relative())
+                t_file = manifestA.parent_path() / t_file;
+
+            add(t_file);
+        }
+
+    return;
+}
+
+uint64_t Batch::run(std::ostream &osA)
+{
+    std::atomic<std::size_t> t_next{0};
+    std::vector<std::thread> t_pool{};
+    const unsigned t_threads = std::min<std::size_t>(m_threads, std::max<std::size_t>(m_jobs.size(), 1));
+
+    // Output and log files of all jobs are placed in the output directory
+    boost::filesystem::create_directories(m_outDir);
+
+    // Instrumentation and tracer are active per thread, thus every worker records into its own
+    Instrumentation *t_inst = Instrumentation::getCurrent();
+    Tracer *t_tracer = Tracer::getCurrent();
+    std::vector<std::unique_ptr<Instrumentation>> t_insts{};
+    std::vector<std::unique_ptr<Tracer>> t_tracers{};
+
+    for (unsigned t = 0; t < t_threads; ++t)
+        {
+            t_insts.emplace_back(t_inst ? new Instrumentation{} : nullptr);
+            t_tracers.emplace_back(t_tracer ? new Tracer{} : nullptr);
+        }
+
+    auto t_begin = std::chrono::steady_clock::now();
+
+    // The calling thread is one of the workers
+    for (unsigned t = 1; t < t_threads; ++t)
+        t_pool.emplace_back(&Batch::work, this, std::ref(t_next), t_insts[t].get(), t_tracers[t].get());
+
+    work(t_next, t_insts[0].get(), t_tracers[0].get());
+
+    for (auto &thread : t_pool)
+        thread.join();
+
+    for (unsigned t = 0; t < t_threads; ++t)
+        {
+            if (t_inst)
+                t_inst->merge(*t_insts[t]);
+
+            // Worker 0 is the calling thread with thread ID 1 of its tracer
+            if (t_tracer)
+                t_tracer->merge(*t_tracers[t], t + 1);
+        }
+
+    auto t_end = std::chrono::steady_clock::now();
+    const double t_ms = std::chrono::duration<double, std::milli>(t_end - t_begin).count();
+    uint64_t t_failed{0};
+
+    for (const auto &job : m_jobs)
+        {
+            if (job.success)
+                {
+                    osA << job.file.string() << " -> " << job.output.string() << " (" << std::fixed
+                        << std::setprecision(1) << job.milliseconds << " ms)" << std::endl;
+                }
+            else
+                {
+                    osA << job.file.string() << ": " << job.error << std::endl;
+                    ++t_failed;
+                }
+        }
+
+    osA << "Assembled " << m_jobs.size() - t_failed << " of " << m_jobs.size() << " files with " << t_threads
+        << " threads in " << std::fixed << std::setprecision(1) << t_ms << " ms ("
+        << (t_ms > 0.0 ? 1000.0 * m_jobs.size() / t_ms : 0.0) << " files/s)" << std::endl;
+
+    return t_failed;
+}
+
+const std::vector<Batch::Job> &Batch::getJobs(void) const
+{
+    return m_jobs;
+}
+
+unsigned Batch::getThreads(void) const
+{
+    return m_threads;
+}
+
+void Batch::work(std::atomic<std::size_t> &nextA, Instrumentation *instA, Tracer *tracerA)
+{
+    // Restore the active instrumentation and tracer of the calling thread afterwards
+    Instrumentation *t_inst = Instrumentation::getCurrent();
+    Tracer *t_tracer = Tracer::getCurrent();
+
+    Instrumentation::setCurrent(instA);
+    Tracer::setCurrent(tracerA);
+
+    for (std::size_t t_idx = nextA++; t_idx < m_jobs.size(); t_idx = nextA++)
+        execute(m_jobs[t_idx]);
+
+    Instrumentation::setCurrent(t_inst);
+    Tracer::setCurrent(t_tracer);
+
+    return;
+}
+
+void Batch::execute(Job &jobA) const
+{
+    auto t_begin = std::chrono::steady_clock::now();
+    boost::filesystem::path t_file{jobA.file};
+    boost::property_tree::ptree t_config{m_config};
+    boost::filesystem::ofstream t_log{boost::filesystem::path{jobA.output}.replace_extension(".log")};
+
+    t_config.put("General.Output", jobA.output.string());
+
+    try
+        {
+            if (!boost::filesystem::is_regular_file(t_file))
+                throw AssemblerException("Assembler file " + t_file.string() + " is missing.", 1017);
+
+            Assembler t_as{t_file, t_config, t_log};
+            t_as.parse();
+            t_as.assemble();
+            jobA.success = true;
+        }
+    catch (const std::exception &e)
+        {
+            // Error message without line break for one line per job
+            jobA.error = e.what();
+            jobA.error.erase(jobA.error.find_last_not_of('\n') + 1);
+            jobA.success = false;
+            t_log << jobA.error << std::endl;
+        }
+
+    auto t_end = std::chrono::steady_clock::now();
+    jobA.milliseconds = std::chrono::duration<double, std::milli>(t_end - t_begin).count();
+
+    return;
+}
+
+} /* End namespace as */
@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "assembler.h"
+#include "benchmark.h"
+#include "constexprwriter.h"
+#include "instructionstream.h"
+#include "kernelgenerator.h"
+#include "level.h"
+#include "myException.h"
+#include "parseobjectconst.h"
+#include "parseobjectvariable.h"
+#include "shardedwriter.h"
+#include "threeoperand.h"
+#include "twooperand.h"
+#include "vectorwriter.h"
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/program_options.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+namespace fs = boost::filesystem;
+namespace pt = boost::property_tree;
+
+/**
+ * @brief Prevent the compiler from removing benchmarked computations.
+ */
+volatile uint64_t sink{0};
+
+/**
+ * @brief Count lines of a text file.
+ */
+uint64_t countLines(const fs::path &pathA)
+{
+    fs::ifstream t_is{pathA};
+    std::string t_line{};
+    uint64_t t_count{0};
+
+    while (std::getline(t_is, t_line))
+        ++t_count;
+
+    return t_count;
+}
+
+/**
+ * @brief Run the assembler pipeline on a file.
+ *
+ * @param[in] fileA Assembler file.
+ * @param[in] configA Program configuration.
+ * @param[in] outputA Path of output header.
+ * @param[in] levelA Optimization level.
+ * @param[in] parseOnlyA Stop after parsing.
+ */
+void runAssembler(const fs::path &fileA, const pt::ptree &configA, const fs::path &outputA, const unsigned levelA,
+                  const bool parseOnlyA)
+{
+    fs::path t_file{fileA};
+    pt::ptree t_config{configA};
+    std::ostream t_log{nullptr};
+
+    t_config.put("General.Output", outputA.string());
+    t_config.put("General.Optimize", levelA);
+
+    as::Assembler t_as{t_file, t_config, t_log};
+    t_as.parse();
+
+    if (!parseOnlyA)
+        t_as.assemble();
+
+    return;
+}
+
+/**
+ * @brief Register micro benchmarks of assembler components.
+ */
+void addMicroBenchmarks(as::Benchmark &benchA, const pt::ptree &configA, const fs::path &examplesA,
+                        const fs::path &tmpA)
+{
+    // Lexing and parsing of an assembler file, one operation per line
+    const fs::path t_conv = examplesA / "kernelConv9x9.asm";
+
+    benchA.add("micro/parse", [t_conv, &configA, tmpA]() {
+        runAssembler(t_conv, configA, tmpA / "parse.hpp", 0, true);
+        return countLines(t_conv);
+    });
+
+    // Symbol lookup of constants and variables through two levels
+    benchA.add("micro/lookup", []() {
+        as::Level t_top{};
+        as::Level t_loop{&t_top};
+        std::vector<std::string> t_names{};
+
+        for (int32_t i = 0; i < 32; ++i)
+            {
+                t_names.push_back("const" + std::to_string(i));
+                t_top.addParseObj(new as::ParseObjectConst(t_names.back(), i, &t_top, "CONST", 1));
+                t_names.push_back("var" + std::to_string(i));
+                t_loop.addParseObj(new as::ParseObjectVariable(t_names.back(), i, &t_loop, "VAR", 1));
+            }
+
+        uint64_t t_found{0};
+
+        for (uint32_t r = 0; r < 64; ++r)
+            for (const auto &name : t_names)
+                t_found += t_loop.findParseObj(name) != nullptr;
+
+        sink = t_found;
+
+        return uint64_t{64} * t_names.size();
+    });
+
+    // Encoding of commands with two and three operands
+    benchA.add("micro/encode-two-operand", [&configA]() {
+        as::Level t_top{};
+        auto t_addr = new as::ParseObjectConst("addr", 4096, &t_top, "CONST addr 4096", 1);
+        auto t_line = new as::ParseObjectConst("1", 1, &t_top, "1", 2);
+        t_top.addParseObj(t_addr);
+        t_top.addParseObj(t_line);
+
+        as::TwoOperand t_cmd{&t_top, "LOADPC addr 1", 2, t_addr, t_line,
+                             configA.get<uint32_t>("Assembler_Property.TwoOperator.LOADPC.MachineId", 9)};
+        uint64_t t_sum{0};
+
+        for (uint32_t r = 0; r < 1000; ++r)
+            t_sum += t_cmd.encode(configA);
+
+        sink = t_sum;
+
+        return uint64_t{1000};
+    });
+
+    benchA.add("micro/encode-three-operand", [&configA]() {
+        as::Level t_top{};
+        auto t_addr = new as::ParseObjectConst("addr", 256, &t_top, "CONST addr 256", 1);
+        auto t_line = new as::ParseObjectConst("1", 1, &t_top, "1", 2);
+        auto t_place = new as::ParseObjectConst("3", 3, &t_top, "3", 2);
+        t_top.addParseObj(t_addr);
+        t_top.addParseObj(t_line);
+        t_top.addParseObj(t_place);
+
+        as::ThreeOperand t_cmd{&t_top, "LOADD addr 1 3", 2, t_addr, t_line, t_place, 5};
+        uint64_t t_sum{0};
+
+        for (uint32_t r = 0; r < 1000; ++r)
+            t_sum += t_cmd.encode(configA);
+
+        sink = t_sum;
+
+        return uint64_t{1000};
+    });
+
+    // Emission of an instruction stream with each output writer, one operation per word
+    auto t_source = std::make_shared<as::Level>();
+    auto t_obj = new as::ParseObjBase(t_source.get(), as::COMMANDCLASS::NOOPERAND, "START", 1);
+    t_source->addParseObj(t_obj);
+
+    auto t_stream = std::make_shared<as::InstructionStream>();
+
+    for (uint64_t w = 0; w < 100000; ++w)
+        t_stream->append((w << 16) | 11, t_obj, nullptr);
+
+    const std::vector<std::string> t_formats{"vector", "sharded", "constexpr"};
+
+    for (const auto &format : t_formats)
+        benchA.add("micro/emit-" + format, [t_source, t_stream, format, &configA, tmpA]() {
+            std::unique_ptr<as::IOutputWriter> t_writer{};
+
+            if (format == "sharded")
+                t_writer.reset(new as::ShardedWriter(configA));
+            else if (format == "constexpr")
+                t_writer.reset(new as::ConstexprWriter(configA));
+            else
+                t_writer.reset(new as::VectorWriter(configA));
+
+            t_writer->write(*t_stream, tmpA / ("emit_" + format + ".hpp"));
+
+            return t_stream->size();
+        });
+
+    return;
+}
+
+/**
+ * @brief Register macro benchmarks of the complete assembler pipeline, one operation per run.
+ */
+void addMacroBenchmarks(as::Benchmark &benchA, const pt::ptree &configA, const fs::path &examplesA,
+                        const fs::path &tmpA, const std::vector<uint64_t> &scalesA)
+{
+    std::vector<std::pair<std::string, fs::path>> t_files{{"kernel", examplesA / "kernel.asm"},
+                                                          {"kernelConv9x9", examplesA / "kernelConv9x9.asm"}};
+
+    // Synthetic kernels with an outer loop of scale iterations
+    as::KernelGenerator t_gen{configA};
+    as::KernelGenerator::Parameters t_param{};
+    t_param.depth = 1;
+    t_param.body = 32;
+
+    for (const auto scale : scalesA)
+        {
+            const std::string t_name{"synthetic-" + std::to_string(scale)};
+            const fs::path t_path{tmpA / (t_name + ".asm")};
+            fs::ofstream t_os{t_path};
+
+            t_param.trips = static_cast<uint32_t>(scale);
+            t_gen.generate(t_param, t_os);
+            t_files.emplace_back(t_name, t_path);
+        }
+
+    for (const auto &file : t_files)
+        for (const unsigned level : {0u, 2u})
+            {
+                const std::string t_name{"macro/" + file.first + "-O" + std::to_string(level)};
+                const fs::path t_out{tmpA / (file.first + "_O" + std::to_string(level) + ".hpp")};
+
+                benchA.add(t_name, [file, &configA, t_out, level]() {
+                    runAssembler(file.second, configA, t_out, level, false);
+                    return uint64_t{1};
+                });
+            }
+
+    return;
+}
+
+} // end of anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    namespace po = boost::program_options;
+    //!< @brief Abbreviation for boost program options library.
+
+    /* Define command line options for benchmark tool.
+       help: Shows cmd-tool options
+       config: Program configuration file. (default=examples/config.xml)
+       examples: Directory of example assembler files. (default=examples)
+       filter: Run only benchmarks whose name contains the filter.
+       samples: Timed samples per benchmark.
+       min-time: Minimal time of a sample in milliseconds.
+       scale: Loop iterations of the synthetic kernels of the macro benchmarks.
+       json: Write results as JSON to file ("-" for std::cout).
+     */
+    po::options_description desc("Usable options");
+    desc.add_options()("help,", "Show command line options and usability.")(
+        "config,", po::value<std::string>()->default_value("examples/config.xml"), "Assembler configuration file.")(
+        "examples,", po::value<std::string>()->default_value("examples"), "Directory of example assembler files.")(
+        "filter,", po::value<std::string>()->default_value(""), "Run only benchmarks whose name contains the filter.")(
+        "samples,", po::value<uint32_t>()->default_value(5), "Timed samples per benchmark.")(
+        "min-time,", po::value<double>()->default_value(100.0), "Minimal time of a sample in milliseconds.")(
+        "scale,", po::value<std::vector<uint64_t>>()->multitoken()->default_value({64, 256, 1024}, "64 256 1024"),
+        "Loop iterations of the synthetic kernels.")("json,", po::value<std::string>(), "Write results as JSON (\"-\" = stdout).");
+
+    po::variables_map vm;
+    //!< \brief Variable map to store command line options.
+
+    try
+        {
+            po::store(po::parse_command_line(argc, argv, desc), vm);
+            po::notify(vm);
+        }
+    catch (const po::error &e)
+        {
+            std::cout << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    if (vm.count("help") != 0U)
+        {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+
+    const fs::path t_examples{vm["examples"].as<std::string>()};
+    const fs::path t_tmp{fs::temp_directory_path() / fs::unique_path("cgra_bench_%%%%%%%%")};
+    pt::ptree t_config{};
+
+    try
+        {
+            pt::read_xml(vm["config"].as<std::string>(), t_config);
+            fs::create_directories(t_tmp);
+        }
+    catch (const std::exception &e)
+        {
+            std::cout << "Error while loading configuration file: " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    as::Benchmark t_bench{vm["samples"].as<uint32_t>(), vm["min-time"].as<double>()};
+
+    try
+        {
+            addMicroBenchmarks(t_bench, t_config, t_examples, t_tmp);
+            addMacroBenchmarks(t_bench, t_config, t_examples, t_tmp, vm["scale"].as<std::vector<uint64_t>>());
+        }
+    catch (const std::exception &e)
+        {
+            std::cout << e.what() << std::endl;
+            fs::remove_all(t_tmp);
+            return EXIT_FAILURE;
+        }
+
+    const bool t_jsonOut = vm.count("json") != 0U && vm["json"].as<std::string>() == "-";
+
+    t_bench.run(vm["filter"].as<std::string>(), t_jsonOut ? std::cerr : std::cout);
+
+    if (t_jsonOut)
+        t_bench.writeJson(std::cout);
+    else
+        {
+            t_bench.report(std::cout);
+
+            if (vm.count("json") != 0U)
+                {
+                    fs::ofstream t_os{vm["json"].as<std::string>()};
+
+                    if (!t_os)
+                        {
+                            std::cout << "Cannot open JSON output file." << std::endl;
+                            fs::remove_all(t_tmp);
+                            return EXIT_FAILURE;
+                        }
+
+                    t_bench.writeJson(t_os);
+                }
+        }
+
+    fs::remove_all(t_tmp);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "benchmark.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <streambuf>
+
+namespace
+{
+
+/**
+ * @brief Stream buffer which discards all characters.
+ */
+class NullBuffer : public std::streambuf
+{
+  protected:
+    int overflow(int cA) override
+    {
+        return cA == traits_type::eof() ? 0 : cA;
+    }
+};
+
+/**
+ * @brief Run a body repeatedly and return the elapsed milliseconds.
+ */
+double timeRuns(const std::function<uint64_t(void)> &bodyA, const uint64_t repetitionsA, uint64_t &operationsA)
+{
+    auto t_begin = std::chrono::steady_clock::now();
+
+    for (uint64_t r = 0; r < repetitionsA; ++r)
+        operationsA = bodyA();
+
+    auto t_end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(t_end - t_begin).count();
+}
+
+/**
+ * @brief Quote a string for JSON.
+ */
+std::string quote(const std::string &strA)
+{
+    std::string t_str{"\""};
+
+    for (const char c : strA)
+        {
+            if (c == '"' || c == '\\')
+                t_str += '\\';
+
+            t_str += c;
+        }
+
+    return t_str + "\"";
+}
+
+} // end of anonymous namespace
+
+namespace as
+{
+
+Benchmark::Benchmark(const uint32_t samplesA, const double minTimeA)
+    : m_samples{std::max<uint32_t>(samplesA, 1)}, m_minTime{std::max(minTimeA, 0.0)}, m_benchmarks{}, m_results{}
+{
+    return;
+}
+
+void Benchmark::add(const std::string &nameA, std::function<uint64_t(void)> bodyA)
+{
+    m_benchmarks.emplace_back(nameA, std::move(bodyA));
+    return;
+}
+
+void Benchmark::run(const std::string &filterA, std::ostream &logA)
+{
+    m_results.clear();
+
+    for (const auto &bench : m_benchmarks)
+        {
+            if (bench.first.find(filterA) == std::string::npos)
+                continue;
+
+            logA << "Run " << bench.first << std::endl;
+
+            // Bodies may print debug output of the assembler
+            NullBuffer t_null{};
+            std::streambuf *t_cout = std::cout.rdbuf(&t_null);
+
+            try
+                {
+                    m_results.push_back(measure(bench.first, bench.second));
+                }
+            catch (const std::exception &e)
+                {
+                    std::string t_msg{e.what()};
+                    t_msg.erase(t_msg.find_last_not_of(" \n") + 1);
+                    m_results.push_back(Result{bench.first, 0, 0, 0.0, 0.0, 0.0, t_msg});
+                }
+
+            std::cout.rdbuf(t_cout);
+        }
+
+    return;
+}
+
+Benchmark::Result Benchmark::measure(const std::string &nameA, const std::function<uint64_t(void)> &bodyA) const
+{
+    uint64_t t_operations{0};
+
+    // Warm-up run calibrates the repetitions per sample
+    const double t_warmup = timeRuns(bodyA, 1, t_operations);
+    const uint64_t t_repetitions =
+        t_warmup >= m_minTime ? 1 : static_cast<uint64_t>(std::ceil(m_minTime / std::max(t_warmup, 1e-6)));
+
+    std::vector<double> t_samples{};
+
+    for (uint32_t s = 0; s < m_samples; ++s)
+        {
+            const double t_ms = timeRuns(bodyA, t_repetitions, t_operations);
+            t_samples.push_back(t_ms * 1e6 / static_cast<double>(t_repetitions * std::max<uint64_t>(t_operations, 1)));
+        }
+
+    std::sort(t_samples.begin(), t_samples.end());
+
+    const std::size_t t_mid = t_samples.size() / 2;
+    const double t_median =
+        t_samples.size() % 2 != 0 ? t_samples[t_mid] : (t_samples[t_mid - 1] + t_samples[t_mid]) / 2.0;
+
+    return Result{nameA, t_operations, t_repetitions, t_median, t_samples.front(), t_samples.back(), ""};
+}
+
+const std::vector<Benchmark::Result> &Benchmark::getResults(void) const
+{
+    return m_results;
+}
+
+void Benchmark::report(std::ostream &osA) const
+{
+    osA << std::left << std::setw(36) << "Benchmark" << std::right << std::setw(14) << "ns/op" << std::setw(14)
+        << "min" << std::setw(14) << "max" << std::setw(12) << "ops" << std::endl;
+
+    for (const auto &result : m_results)
+        {
+            osA << std::left << std::setw(36) << result.name << std::right;
+
+            if (!result.error.empty())
+                osA << "  failed: " << result.error << std::endl;
+            else
+                osA << std::fixed << std::setprecision(1) << std::setw(14) << result.median << std::setw(14)
+                    << result.min << std::setw(14) << result.max << std::defaultfloat << std::setw(12)
+                    << result.operations << std::endl;
+        }
+
+    return;
+}
+
+void Benchmark::writeJson(std::ostream &osA) const
+{
+    osA << "{\n  \"samples\": " << m_samples << ",\n  \"min_sample_ms\": " << m_minTime
+        << ",\n  \"benchmarks\": [";
+
+    for (std::size_t r = 0; r < m_results.size(); ++r)
+        {
+            const Result &t_res = m_results[r];
+
+            osA << (r != 0 ? "," : "") << "\n    {\"name\": " << quote(t_res.name);
+
+            if (!t_res.error.empty())
+                osA << ", \"error\": " << quote(t_res.error) << "}";
+            else
+                osA << ", \"ns_per_op\": " << std::fixed << std::setprecision(3) << t_res.median
+                    << ", \"min_ns_per_op\": " << t_res.min << ", \"max_ns_per_op\": " << t_res.max
+                    << std::defaultfloat << ", \"operations\": " << t_res.operations
+                    << ", \"repetitions\": " << t_res.repetitions << "}";
+        }
+
+    osA << "\n  ]\n}" << std::endl;
+
+    return;
+}
+
+} /* End namespace as */
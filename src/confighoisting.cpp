@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "confighoisting.h"
+#include "iarithmetic.h"
+#include "loop.h"
+#include "nooperand.h"
+#include "oneoperand.h"
+#include "parseobjectconst.h"
+#include "resetvariable.h"
+#include "threeoperand.h"
+#include "twooperand.h"
+#include <algorithm>
+
+namespace as
+{
+
+ConfigHoisting::ConfigHoisting(const InstructionSet &isaA)
+    : m_loadIds{{isaA.getMachineId("LOADPC"), isaA.getMachineId("LOADCC")}},
+      m_selectIds{{isaA.getMachineId("SLCT_PECC_LINE"), isaA.getMachineId("SLCT_CHCC_LINE")}},
+      m_start{isaA.getMachineId("START")}, m_stored{isaA.getMachineId("STORED")},
+      m_storeda{isaA.getMachineId("STOREDA")}
+{
+    return;
+}
+
+std::string ConfigHoisting::getName(void) const
+{
+    return "config-hoisting";
+}
+
+uint64_t ConfigHoisting::run(Level *const levelA)
+{
+    m_hoisted.clear();
+
+    hoistIn(levelA);
+
+    return m_hoisted.size();
+}
+
+uint64_t ConfigHoisting::getSavedTransfers(void) const
+{
+    uint64_t t_saved{0};
+
+    for (const auto &hoist : m_hoisted)
+        t_saved += hoist.innermost->getIterations() - hoist.outermost->getEntries();
+
+    return t_saved;
+}
+
+void ConfigHoisting::report(std::ostream &osA) const
+{
+    for (const auto &hoist : m_hoisted)
+        {
+            osA << "    " << hoist.load->getReadCmdLine() << " (line " << hoist.load->getFileLineNumber()
+                << ") hoisted out of " << hoist.outermost->getReadCommandLine() << " (line "
+                << hoist.outermost->getFileLine() << "): "
+                << hoist.innermost->getIterations() - hoist.outermost->getEntries() << " transfers saved"
+                << std::endl;
+        }
+
+    osA << "    Configuration transfers saved: " << getSavedTransfers() << std::endl;
+
+    return;
+}
+
+void ConfigHoisting::hoistIn(Level *const levelA)
+{
+    uint64_t lvlId{0};
+
+    for (uint64_t k = 0; k < levelA->getParseObjList().size(); ++k)
+        {
+            if (levelA->getParseObj(k)->getCommandClass() != COMMANDCLASS::LOOP)
+                continue;
+
+            auto t_loop = static_cast<Loop *>(levelA->at(lvlId++));
+
+            hoistIn(t_loop);
+
+            // Insert hoisted loads in front of the loop marker
+            for (auto load : hoistOutOf(t_loop))
+                {
+                    levelA->insertParseObj(k++, load);
+
+                    auto t_it = std::find_if(m_hoisted.begin(), m_hoisted.end(),
+                                             [load](const Hoist &hoistA) { return hoistA.load == load; });
+
+                    if (t_it != m_hoisted.end())
+                        t_it->outermost = t_loop;
+                    else
+                        m_hoisted.push_back(Hoist{load, t_loop, t_loop});
+                }
+        }
+
+    return;
+}
+
+std::vector<ParseObjBase *> ConfigHoisting::hoistOutOf(Loop *const loopA)
+{
+    std::vector<ParseObjBase *> t_hoisted{};
+    Summary t_loop{{}, {}, {{false, false}}, false, false};
+
+    summarize(loopA, t_loop);
+
+    if (t_loop.stores)
+        return t_hoisted;
+
+    // START and selects in front of the current position of the loop body
+    Summary t_front{{}, {}, {{false, false}}, false, false};
+    uint64_t lvlId{0};
+
+    for (uint64_t k = 0; k < loopA->getParseObjList().size(); ++k)
+        {
+            auto t_po = loopA->getParseObj(k);
+
+            if (t_po->getCommandClass() == COMMANDCLASS::LOOP)
+                {
+                    summarize(loopA->at(lvlId++), t_front);
+                    continue;
+                }
+            else if (t_po->getCommandClass() == COMMANDCLASS::NOOPERAND)
+                {
+                    t_front.start |= static_cast<NoOperand *>(t_po)->getMachineCodeId() == m_start;
+                    continue;
+                }
+            else if (t_po->getCommandClass() == COMMANDCLASS::ONEOPERAND)
+                {
+                    auto t_cache = getCache(t_po, m_selectIds);
+
+                    if (t_cache != SIZE_MAX)
+                        t_front.selects[t_cache] = true;
+                    continue;
+                }
+
+            auto t_cache = getCache(t_po, m_loadIds);
+
+            if (t_cache == SIZE_MAX || t_front.start || t_front.selects[t_cache])
+                continue;
+
+            auto t_load = static_cast<TwoOperand *>(t_po);
+
+            if (!isInvariant(t_load->getFirst(), t_loop) || !isInvariant(t_load->getSecond(), t_loop))
+                continue;
+
+            // Other loads of the same cache must use another constant line
+            bool t_conflict{false};
+
+            for (auto other : t_loop.loads[t_cache])
+                {
+                    if (other == t_po)
+                        continue;
+
+                    auto t_line = static_cast<const TwoOperand *>(other)->getSecond();
+
+                    if (t_line->getCommandClass() != COMMANDCLASS::CONSTANT ||
+                        t_load->getSecond()->getCommandClass() != COMMANDCLASS::CONSTANT ||
+                        static_cast<const ParseObjectConst *>(t_line)->getConstValue() ==
+                            static_cast<const ParseObjectConst *>(t_load->getSecond())->getConstValue())
+                        {
+                            t_conflict = true;
+                            break;
+                        }
+                }
+
+            if (t_conflict)
+                continue;
+
+            t_hoisted.push_back(loopA->deleteParseObj(k--));
+        }
+
+    return t_hoisted;
+}
+
+void ConfigHoisting::summarize(const Level *const levelA, Summary &sumA) const
+{
+    for (auto po : levelA->getParseObjList())
+        {
+            switch (po->getCommandClass())
+                {
+                case COMMANDCLASS::ARITHMETIC:
+                    sumA.modified.push_back(static_cast<IArithmetic *>(po)->getFirst());
+                    break;
+                case COMMANDCLASS::RESETVAR:
+                    sumA.modified.push_back(static_cast<ResetVariable *>(po)->getVariable());
+                    break;
+                case COMMANDCLASS::NOOPERAND:
+                    sumA.start |= static_cast<NoOperand *>(po)->getMachineCodeId() == m_start;
+                    break;
+                case COMMANDCLASS::ONEOPERAND:
+                    {
+                        auto t_cache = getCache(po, m_selectIds);
+
+                        if (t_cache != SIZE_MAX)
+                            sumA.selects[t_cache] = true;
+                        break;
+                    }
+                case COMMANDCLASS::TWOOPERAND:
+                    {
+                        auto t_cache = getCache(po, m_loadIds);
+
+                        if (t_cache != SIZE_MAX)
+                            sumA.loads[t_cache].push_back(po);
+                        else if (static_cast<TwoOperand *>(po)->getMachineCodeId() == m_storeda)
+                            sumA.stores = true;
+                        break;
+                    }
+                case COMMANDCLASS::THREEOPERAND:
+                    sumA.stores |= static_cast<ThreeOperand *>(po)->getMachineCodeId() == m_stored;
+                    break;
+                default:
+                    break;
+                }
+        }
+
+    for (auto it = levelA->cbegin(); it != levelA->cend(); ++it)
+        summarize(*it, sumA);
+
+    return;
+}
+
+bool ConfigHoisting::isInvariant(const ParseObjBase *const opA, const Summary &sumA) const
+{
+    if (opA->getCommandClass() == COMMANDCLASS::CONSTANT)
+        return true;
+    else if (opA->getCommandClass() == COMMANDCLASS::VARIABLE)
+        return std::find(sumA.modified.cbegin(), sumA.modified.cend(), opA) == sumA.modified.cend();
+    else
+        return false;
+}
+
+std::size_t ConfigHoisting::getCache(const ParseObjBase *const poA, const std::array<uint32_t, 2> &idsA) const
+{
+    uint32_t t_id{UINT32_MAX};
+
+    if (poA->getCommandClass() == COMMANDCLASS::ONEOPERAND)
+        t_id = static_cast<const OneOperand *>(poA)->getMachineCodeId();
+    else if (poA->getCommandClass() == COMMANDCLASS::TWOOPERAND)
+        t_id = static_cast<const TwoOperand *>(poA)->getMachineCodeId();
+
+    for (std::size_t c = 0; c < idsA.size(); ++c)
+        {
+            if (t_id != UINT32_MAX && t_id == idsA[c])
+                return c;
+        }
+
+    return SIZE_MAX;
+}
+
+} /* End namespace as */
@@ -0,0 +1,97 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "constexprwriter.h"
+#include "myException.h"
+#include "tracer.h"
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+
+namespace as
+{
+
+ConstexprWriter::ConstexprWriter(const boost::property_tree::ptree &configA) : IOutputWriter{configA}
+{
+    return;
+}
+
+std::vector<boost::filesystem::path> ConstexprWriter::write(const InstructionStream &streamA,
+                                                            const boost::filesystem::path &outPathA)
+{
+    // Select smallest word type which holds all machine code words
+    uint64_t t_maxWord{0};
+
+    for (auto it = streamA.cbegin(); it != streamA.cend(); ++it)
+        t_maxWord = std::max(t_maxWord, it->word);
+
+    const std::string t_type = t_maxWord > UINT32_MAX ? "std::uint64_t" : "std::uint32_t";
+
+    // Opening file to store machine code.
+    CGRA_TRACE_SPAN("flush", "output");
+    CGRA_TRACE_ARG("file", outPathA.string());
+    CGRA_TRACE_ARG("words", streamA.size());
+    std::filebuf t_fb;
+
+    if (t_fb.open(outPathA.c_str(), std::ios::out))
+        {
+            std::ostream t_codeFile(&t_fb);
+            const auto t_guard = getGuardName(outPathA);
+            char t_buf[24];
+
+            t_codeFile << "#ifndef " << t_guard << "\n";
+            t_codeFile << "#define " << t_guard << "\n\n\n";
+
+            writeInclude(t_codeFile);
+            t_codeFile << "#include <cstddef>\n";
+            t_codeFile << "#include <cstdint>\n\n";
+            t_codeFile << "namespace cgra \n{\n\n";
+            t_codeFile << "constexpr std::size_t assembly_size = " << streamA.size() << ";\n\n";
+
+            if (streamA.empty())
+                {
+                    // Zero sized arrays are not allowed, thus an empty program gets a placeholder word.
+                    t_codeFile << "constexpr " << t_type << " assembly[1] = {0u};\n\n";
+                }
+            else
+                {
+                    t_codeFile << "constexpr " << t_type << " assembly[assembly_size] = {\n";
+
+                    for (auto it = streamA.cbegin(); it != streamA.cend(); ++it)
+                        {
+                            std::snprintf(t_buf, sizeof(t_buf), "0x%08" PRIX64 "u,", it->word);
+                            t_codeFile << t_buf;
+                            writeComment(t_codeFile, *it);
+                        }
+
+                    t_codeFile << "};\n\n";
+                }
+
+            t_codeFile << "} //End namespace cgra\n\n";
+            t_codeFile << "#endif //" << t_guard << "\n";
+            t_fb.close();
+        }
+    else
+        {
+            throw AssemblerException("Error while opening output file.", 4500);
+        }
+
+    return std::vector<boost::filesystem::path>{outPathA};
+}
+
+} /* End namespace as */
@@ -0,0 +1,258 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "deadcodeelimination.h"
+#include "add.h"
+#include "addinteger.h"
+#include "iarithmetic.h"
+#include "loop.h"
+#include "mul.h"
+#include "mulinteger.h"
+#include "oneoperand.h"
+#include "parseobjectconst.h"
+#include "parseobjectvariable.h"
+#include "resetvariable.h"
+#include "sub.h"
+#include "subinteger.h"
+#include "threeoperand.h"
+#include "twooperand.h"
+
+namespace as
+{
+
+std::string DeadCodeElimination::getName(void) const
+{
+    return "dead-code-elimination";
+}
+
+uint64_t DeadCodeElimination::run(Level *const levelA)
+{
+    m_objects.clear();
+    m_loops.clear();
+    m_modified.clear();
+    m_dead.clear();
+    m_constResets = 0;
+    m_identities = 0;
+    m_unused = 0;
+
+    std::unordered_set<const ParseObjBase *> t_live{};
+
+    collect(levelA);
+
+    // Identity operations and targets of remaining operations
+    for (auto po : m_objects)
+        {
+            if (po->getCommandClass() != COMMANDCLASS::ARITHMETIC)
+                continue;
+
+            auto t_op = static_cast<IArithmetic *>(po);
+            int32_t t_value{0};
+
+            if (t_op->getFirst()->getCommandClass() == COMMANDCLASS::VARIABLE &&
+                t_op->getSecond()->getCommandClass() == COMMANDCLASS::CONSTANT)
+                {
+                    t_value = static_cast<ParseObjectConst *>(t_op->getSecond())->getConstValue();
+
+                    if ((t_value == 0 && (dynamic_cast<Add *>(po) || dynamic_cast<AddInteger *>(po) ||
+                                          dynamic_cast<Sub *>(po) || dynamic_cast<SubInteger *>(po))) ||
+                        (t_value == 1 && (dynamic_cast<Mul *>(po) || dynamic_cast<MulInteger *>(po))))
+                        {
+                            m_dead.insert(po);
+                            ++m_identities;
+                            continue;
+                        }
+                }
+
+            m_modified.insert(t_op->getFirst());
+        }
+
+    // Constant propagation: Resets to the initial value of otherwise constant variables
+    bool t_changed{true};
+
+    while (t_changed)
+        {
+            t_changed = false;
+
+            for (auto po : m_objects)
+                {
+                    if (po->getCommandClass() != COMMANDCLASS::RESETVAR)
+                        continue;
+
+                    auto t_reset = static_cast<ResetVariable *>(po);
+                    auto t_var = t_reset->getVariable();
+                    int32_t t_value{0};
+
+                    if (m_modified.count(t_var) != 0U)
+                        continue;
+
+                    if (!getConstant(t_reset->getValue(), t_value) ||
+                        t_value != static_cast<ParseObjectVariable *>(t_var)->getVariableValue())
+                        {
+                            m_modified.insert(t_var);
+                            t_changed = true;
+                        }
+                }
+        }
+
+    for (auto po : m_objects)
+        {
+            if (po->getCommandClass() == COMMANDCLASS::RESETVAR &&
+                m_modified.count(static_cast<ResetVariable *>(po)->getVariable()) == 0U)
+                {
+                    m_dead.insert(po);
+                    ++m_constResets;
+                }
+        }
+
+    // Liveness: Operands of commands and loop ranges
+    for (auto po : m_objects)
+        {
+            switch (po->getCommandClass())
+                {
+                case COMMANDCLASS::ONEOPERAND:
+                    t_live.insert(static_cast<OneOperand *>(po)->getFirst());
+                    break;
+                case COMMANDCLASS::TWOOPERAND:
+                    t_live.insert(static_cast<TwoOperand *>(po)->getFirst());
+                    t_live.insert(static_cast<TwoOperand *>(po)->getSecond());
+                    break;
+                case COMMANDCLASS::THREEOPERAND:
+                    t_live.insert(static_cast<ThreeOperand *>(po)->getFirst());
+                    t_live.insert(static_cast<ThreeOperand *>(po)->getSecond());
+                    t_live.insert(static_cast<ThreeOperand *>(po)->getThird());
+                    break;
+                default:
+                    break;
+                }
+        }
+
+    // Loop ranges are evaluated in every iteration
+    for (auto loop : m_loops)
+        {
+            t_live.insert(loop->getStartValue());
+            t_live.insert(loop->getEndValue());
+            t_live.insert(loop->getStepWidth());
+        }
+
+    // Operands of operations and resets of live variables are live
+    t_changed = true;
+
+    while (t_changed)
+        {
+            t_changed = false;
+
+            for (auto po : m_objects)
+                {
+                    const ParseObjBase *t_target{nullptr};
+                    const ParseObjBase *t_source{nullptr};
+
+                    if (m_dead.count(po) != 0U)
+                        continue;
+                    else if (po->getCommandClass() == COMMANDCLASS::ARITHMETIC)
+                        {
+                            t_target = static_cast<IArithmetic *>(po)->getFirst();
+                            t_source = static_cast<IArithmetic *>(po)->getSecond();
+                        }
+                    else if (po->getCommandClass() == COMMANDCLASS::RESETVAR)
+                        {
+                            t_target = static_cast<ResetVariable *>(po)->getVariable();
+                            t_source = static_cast<ResetVariable *>(po)->getValue();
+                        }
+                    else
+                        continue;
+
+                    if (t_live.count(t_target) != 0U && t_live.insert(t_source).second)
+                        t_changed = true;
+                }
+        }
+
+    for (auto po : m_objects)
+        {
+            if (m_dead.count(po) != 0U)
+                continue;
+
+            // Operations on constants are kept to report their error while assembling
+            if ((po->getCommandClass() == COMMANDCLASS::ARITHMETIC &&
+                 static_cast<IArithmetic *>(po)->getFirst()->getCommandClass() == COMMANDCLASS::VARIABLE &&
+                 t_live.count(static_cast<IArithmetic *>(po)->getFirst()) == 0U) ||
+                (po->getCommandClass() == COMMANDCLASS::RESETVAR &&
+                 t_live.count(static_cast<ResetVariable *>(po)->getVariable()) == 0U))
+                {
+                    m_dead.insert(po);
+                    ++m_unused;
+                }
+        }
+
+    remove(levelA);
+
+    return m_dead.size();
+}
+
+void DeadCodeElimination::report(std::ostream &osA) const
+{
+    osA << "    Resets of constant variables: " << m_constResets << '\n';
+    osA << "    Identity operations: " << m_identities << '\n';
+    osA << "    Operations and resets of unused variables: " << m_unused << std::endl;
+
+    return;
+}
+
+void DeadCodeElimination::collect(Level *const levelA)
+{
+    for (auto po : levelA->getParseObjList())
+        m_objects.push_back(po);
+
+    for (auto it = levelA->cbegin(); it != levelA->cend(); ++it)
+        {
+            m_loops.push_back(static_cast<const Loop *>(*it));
+            collect(*it);
+        }
+
+    return;
+}
+
+bool DeadCodeElimination::getConstant(const ParseObjBase *const opA, int32_t &valueA) const
+{
+    if (opA->getCommandClass() == COMMANDCLASS::CONSTANT)
+        {
+            valueA = static_cast<const ParseObjectConst *>(opA)->getConstValue();
+            return true;
+        }
+    else if (opA->getCommandClass() == COMMANDCLASS::VARIABLE && m_modified.count(opA) == 0U)
+        {
+            valueA = static_cast<const ParseObjectVariable *>(opA)->getVariableValue();
+            return true;
+        }
+    else
+        return false;
+}
+
+void DeadCodeElimination::remove(Level *const levelA)
+{
+    for (uint64_t k = 0; k < levelA->getParseObjList().size(); ++k)
+        {
+            if (m_dead.count(levelA->getParseObj(k)) != 0U)
+                delete levelA->deleteParseObj(k--);
+        }
+
+    for (auto it = levelA->begin(); it != levelA->end(); ++it)
+        remove(*it);
+
+    return;
+}
+
+} /* End namespace as */
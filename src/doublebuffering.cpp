@@ -0,0 +1,439 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "doublebuffering.h"
+#include <algorithm>
+
+namespace as
+{
+
+DoubleBuffering::DoubleBuffering(const InstructionSet &isaA, const boost::property_tree::ptree &configA)
+    : m_isa{isaA}, m_slctDic{isaA.getMachineId("SLCT_DIC_LINE")}, m_slctDoc{isaA.getMachineId("SLCT_DOC_LINE")},
+      m_slctPecc{isaA.getMachineId("SLCT_PECC_LINE")}, m_slctChcc{isaA.getMachineId("SLCT_CHCC_LINE")},
+      m_loadd{isaA.getMachineId("LOADD")}, m_loadda{isaA.getMachineId("LOADDA")},
+      m_stored{isaA.getMachineId("STORED")}, m_storeda{isaA.getMachineId("STOREDA")},
+      m_start{isaA.getMachineId("START")}, m_wait{isaA.getMachineId("WAIT_READY")},
+      m_numDicLines{configA.get<uint32_t>("VCGRA_Property.Num_Dic_Lines", 0)},
+      m_numDicPlaces{configA.get<uint32_t>("VCGRA_Property.Num_Dic_Places", 0)},
+      m_numDocLines{configA.get<uint32_t>("VCGRA_Property.Num_Doc_Lines", 0)},
+      m_numDocPlaces{configA.get<uint32_t>("VCGRA_Property.Num_Doc_Places", 0)},
+      m_dicStride{std::max<uint64_t>(configA.get<uint64_t>("VCGRA_Property.Dic_Place_Stride", 1), 1)},
+      m_docStride{std::max<uint64_t>(configA.get<uint64_t>("VCGRA_Property.Doc_Place_Stride", 1), 1)},
+      m_runs{0}, m_tiles{0}
+{
+    return;
+}
+
+std::string DoubleBuffering::getName(void) const
+{
+    return "double-buffering";
+}
+
+uint64_t DoubleBuffering::run(InstructionStream &streamA)
+{
+    m_runs = 0;
+    m_tiles = 0;
+
+    // Pass is not applicable for instruction set
+    for (auto id : {m_slctDic, m_slctDoc, m_loadd, m_loadda, m_stored, m_storeda, m_start, m_wait})
+        {
+            if (id == UINT32_MAX)
+                return 0;
+        }
+
+    if (m_numDicLines < 2)
+        return 0;
+
+    const std::vector<Instruction> &t_insts = streamA.getInstructions();
+
+    // Count references of data cache lines for renaming
+    m_dicLoads.assign(m_numDicLines, 0);
+    m_dicRefs.assign(m_numDicLines, 0);
+    m_docRefs.assign(m_numDocLines, 0);
+
+    for (const auto &inst : t_insts)
+        {
+            const auto t_id = m_isa.getMachineCode(inst.word);
+            const auto t_line = m_isa.getLine(inst.word);
+
+            if ((t_id == m_loadd || t_id == m_loadda) && t_line < m_numDicLines)
+                {
+                    ++m_dicLoads[t_line];
+                    ++m_dicRefs[t_line];
+                }
+            else if (t_id == m_slctDic && t_line < m_numDicLines)
+                ++m_dicRefs[t_line];
+            else if ((t_id == m_stored || t_id == m_storeda || t_id == m_slctDoc) && t_line < m_numDocLines)
+                ++m_docRefs[t_line];
+        }
+
+    std::vector<Instruction> t_out{};
+    t_out.reserve(t_insts.size() + t_insts.size() / 4);
+
+    Selection t_sel{UINT32_MAX, UINT32_MAX};
+    uint64_t i{0};
+
+    while (i < t_insts.size())
+        {
+            // Collect run of consecutive tiles
+            std::vector<Tile> t_chain{};
+            Tile t_tile;
+
+            while (parseTile(t_insts, t_chain.empty() ? i : t_chain.back().end, t_sel, t_tile))
+                t_chain.push_back(t_tile);
+
+            if (t_chain.empty())
+                {
+                    updateSelection(t_insts[i], t_sel);
+                    t_out.push_back(t_insts[i++]);
+                    continue;
+                }
+
+            // Split chain where loads of a tile depend on stores of its predecessor
+            std::vector<Tile> t_run{};
+
+            for (uint64_t k = 0; k < t_chain.size(); ++k)
+                {
+                    t_run.push_back(t_chain[k]);
+
+                    if (k + 1 < t_chain.size() && !conflicts(t_insts, t_chain[k], t_chain[k + 1]))
+                        continue;
+
+                    Schedule t_schedule;
+
+                    if (t_run.size() > 1 && plan(t_insts, t_run, t_schedule))
+                        {
+                            emit(streamA, t_insts, t_run, t_schedule, t_out);
+                            ++m_runs;
+                            m_tiles += t_run.size();
+                        }
+                    else
+                        t_out.insert(t_out.end(), t_insts.begin() + t_run.front().begin,
+                                     t_insts.begin() + t_run.back().end);
+
+                    t_run.clear();
+                }
+
+            i = t_chain.back().end;
+        }
+
+    streamA.getInstructions().swap(t_out);
+
+    return m_tiles;
+}
+
+void DoubleBuffering::report(std::ostream &osA) const
+{
+    osA << "    " << m_tiles << " tiles in " << m_runs << " runs pipelined" << std::endl;
+
+    return;
+}
+
+bool DoubleBuffering::parseTile(const std::vector<Instruction> &instsA, const uint64_t idxA, Selection &selA,
+                                Tile &tileA) const
+{
+    Selection t_sel = selA;
+    uint64_t k = idxA;
+
+    tileA.begin = idxA;
+    tileA.pre.clear();
+    tileA.loads.clear();
+    tileA.stores.clear();
+
+    // Selects and loads in front of START
+    for (; k < instsA.size(); ++k)
+        {
+            const auto t_id = m_isa.getMachineCode(instsA[k].word);
+
+            if (t_id == m_slctDic || t_id == m_slctDoc)
+                updateSelection(instsA[k], t_sel);
+            else if (t_id != UINT32_MAX && (t_id == m_slctPecc || t_id == m_slctChcc))
+                tileA.pre.push_back(k);
+            else if (t_id == m_loadd || t_id == m_loadda)
+                tileA.loads.push_back(k);
+            else
+                break;
+        }
+
+    if (tileA.loads.empty() || k + 1 >= instsA.size() || m_isa.getMachineCode(instsA[k].word) != m_start ||
+        m_isa.getMachineCode(instsA[k + 1].word) != m_wait)
+        return false;
+
+    tileA.start = k++;
+    tileA.wait = k++;
+
+    for (; k < instsA.size(); ++k)
+        {
+            const auto t_id = m_isa.getMachineCode(instsA[k].word);
+
+            if (t_id == m_stored || t_id == m_storeda)
+                tileA.stores.push_back(k);
+            else
+                break;
+        }
+
+    tileA.end = k;
+    tileA.dic = t_sel.dic;
+    tileA.doc = t_sel.doc;
+
+    // All loads go to the computed line, all stores read the computed line
+    if (tileA.stores.empty() || tileA.dic >= m_numDicLines || tileA.doc >= m_numDocLines)
+        return false;
+
+    for (auto idx : tileA.loads)
+        {
+            if (m_isa.getLine(instsA[idx].word) != tileA.dic)
+                return false;
+        }
+
+    for (auto idx : tileA.stores)
+        {
+            if (m_isa.getLine(instsA[idx].word) != tileA.doc)
+                return false;
+        }
+
+    selA = t_sel;
+
+    return true;
+}
+
+void DoubleBuffering::updateSelection(const Instruction &instA, Selection &selA) const
+{
+    const auto t_id = m_isa.getMachineCode(instA.word);
+
+    if (t_id == m_slctDic)
+        selA.dic = m_isa.getLine(instA.word);
+    else if (t_id == m_slctDoc)
+        selA.doc = m_isa.getLine(instA.word);
+
+    return;
+}
+
+bool DoubleBuffering::conflicts(const std::vector<Instruction> &instsA, const Tile &storeTileA,
+                                const Tile &loadTileA) const
+{
+    for (auto store : storeTileA.stores)
+        {
+            const auto t_store = getRange(instsA[store].word);
+
+            for (auto load : loadTileA.loads)
+                {
+                    const auto t_load = getRange(instsA[load].word);
+
+                    if (t_load.first < t_store.second && t_store.first < t_load.second)
+                        return true;
+                }
+        }
+
+    return false;
+}
+
+std::pair<uint64_t, uint64_t> DoubleBuffering::getRange(const uint64_t wordA) const
+{
+    const auto t_id = m_isa.getMachineCode(wordA);
+    const auto t_address = m_isa.getAddress(wordA);
+    uint64_t t_size{0};
+
+    if (t_id == m_loadd)
+        t_size = m_dicStride;
+    else if (t_id == m_loadda)
+        t_size = m_numDicPlaces * m_dicStride;
+    else if (t_id == m_stored)
+        t_size = m_docStride;
+    else if (t_id == m_storeda)
+        t_size = m_numDocPlaces * m_docStride;
+
+    return std::make_pair(t_address, t_address + std::max<uint64_t>(t_size, 1));
+}
+
+bool DoubleBuffering::plan(const std::vector<Instruction> &instsA, const std::vector<Tile> &tilesA,
+                           Schedule &scheduleA) const
+{
+    bool t_dicAlternates{true}, t_dicConstant{true};
+    bool t_docAlternates{true}, t_docConstant{true};
+
+    for (uint64_t k = 0; k + 1 < tilesA.size(); ++k)
+        {
+            t_dicAlternates &= tilesA[k].dic != tilesA[k + 1].dic;
+            t_dicConstant &= tilesA[k].dic == tilesA[k + 1].dic;
+            t_docAlternates &= tilesA[k].doc != tilesA[k + 1].doc;
+            t_docConstant &= tilesA[k].doc == tilesA[k + 1].doc;
+        }
+
+    scheduleA = Schedule{false, UINT32_MAX, false, UINT32_MAX, t_docAlternates};
+
+    // Data input cache: Loads of next tile must not overwrite the computed line
+    if (!t_dicAlternates)
+        {
+            const auto t_line = tilesA.front().dic;
+            uint64_t t_loads{0};
+
+            if (!t_dicConstant)
+                return false;
+
+            // Every tile loads the same places, and the line is not loaded outside of the tiles
+            std::vector<bool> t_places{};
+
+            for (const auto &tile : tilesA)
+                {
+                    std::vector<bool> t_tilePlaces(m_numDicPlaces, false);
+
+                    for (auto idx : tile.loads)
+                        {
+                            if (m_isa.getMachineCode(instsA[idx].word) == m_loadda)
+                                t_tilePlaces.assign(m_numDicPlaces, true);
+                            else if (m_isa.getPlace(instsA[idx].word) < m_numDicPlaces)
+                                t_tilePlaces[m_isa.getPlace(instsA[idx].word)] = true;
+                        }
+
+                    if (!t_places.empty() && t_places != t_tilePlaces)
+                        return false;
+
+                    t_places.swap(t_tilePlaces);
+                    t_loads += tile.loads.size();
+                }
+
+            if (m_dicLoads[t_line] != t_loads)
+                return false;
+
+            for (uint32_t line = 0; line < m_numDicLines; ++line)
+                {
+                    if (line != t_line && m_dicRefs[line] == 0)
+                        {
+                            scheduleA.renameDic = true;
+                            scheduleA.altDic = line;
+                            break;
+                        }
+                }
+
+            if (!scheduleA.renameDic)
+                return false;
+        }
+
+    // Data output cache: Stores are delayed, if the next tile computes into another line
+    if (t_docConstant)
+        {
+            for (uint32_t line = 0; line < m_numDocLines; ++line)
+                {
+                    if (line != tilesA.front().doc && m_docRefs[line] == 0)
+                        {
+                            scheduleA.renameDoc = true;
+                            scheduleA.altDoc = line;
+                            scheduleA.delay = true;
+                            break;
+                        }
+                }
+        }
+
+    return true;
+}
+
+void DoubleBuffering::emit(InstructionStream &streamA, const std::vector<Instruction> &instsA,
+                           const std::vector<Tile> &tilesA, const Schedule &scheduleA,
+                           std::vector<Instruction> &outA) const
+{
+    const uint64_t t_last = tilesA.size() - 1;
+
+    // Every second tile counted from the last one uses the alternative lines
+    auto dicOf = [&](const uint64_t k) {
+        return scheduleA.renameDic && (t_last - k) % 2 == 1 ? scheduleA.altDic : tilesA[k].dic;
+    };
+    auto docOf = [&](const uint64_t k) {
+        return scheduleA.renameDoc && (t_last - k) % 2 == 1 ? scheduleA.altDoc : tilesA[k].doc;
+    };
+    auto loads = [&](const uint64_t k) {
+        for (auto idx : tilesA[k].loads)
+            outA.push_back(relocate(streamA, instsA[idx], dicOf(k)));
+    };
+    auto stores = [&](const uint64_t k) {
+        for (auto idx : tilesA[k].stores)
+            outA.push_back(relocate(streamA, instsA[idx], docOf(k)));
+    };
+    auto start = [&](const uint64_t k) {
+        for (auto idx : tilesA[k].pre)
+            outA.push_back(instsA[idx]);
+
+        const auto &t_start = instsA[tilesA[k].start];
+        outA.push_back(select(streamA, t_start, m_slctDic, dicOf(k)));
+        outA.push_back(select(streamA, t_start, m_slctDoc, docOf(k)));
+        outA.push_back(t_start);
+    };
+
+    loads(0);
+    start(0);
+
+    for (uint64_t k = 0; k <= t_last; ++k)
+        {
+            if (scheduleA.delay && k > 0)
+                stores(k - 1);
+
+            if (k < t_last)
+                loads(k + 1);
+
+            outA.push_back(instsA[tilesA[k].wait]);
+
+            if (!scheduleA.delay)
+                stores(k);
+
+            if (k < t_last)
+                start(k + 1);
+        }
+
+    if (scheduleA.delay)
+        stores(t_last);
+
+    return;
+}
+
+Instruction DoubleBuffering::relocate(InstructionStream &streamA, const Instruction &instA,
+                                      const uint32_t lineA) const
+{
+    if (m_isa.getLine(instA.word) == lineA)
+        return instA;
+
+    const auto t_id = m_isa.getMachineCode(instA.word);
+    const auto t_address = m_isa.getAddress(instA.word);
+    const auto t_place = m_isa.getPlace(instA.word);
+    Instruction t_inst = instA;
+    std::string t_cmdLine = m_isa.getName(t_id) + " " + std::to_string(t_address) + " " + std::to_string(lineA);
+
+    if (t_id == m_loadda || t_id == m_storeda)
+        {
+            t_inst.word = m_isa.encodeLine(t_id, t_address, lineA);
+            t_inst.source = streamA.synthesize(*instA.source, COMMANDCLASS::TWOOPERAND, t_cmdLine);
+        }
+    else
+        {
+            t_inst.word = m_isa.encode(t_id, t_address, lineA, t_place);
+            t_inst.source = streamA.synthesize(*instA.source, COMMANDCLASS::THREEOPERAND,
+                                               t_cmdLine + " " + std::to_string(t_place));
+        }
+
+    return t_inst;
+}
+
+Instruction DoubleBuffering::select(InstructionStream &streamA, const Instruction &originA,
+                                    const uint32_t machineIdA, const uint32_t lineA) const
+{
+    return Instruction{
+        m_isa.encode(machineIdA, 0, lineA, 0),
+        streamA.synthesize(*originA.source, COMMANDCLASS::ONEOPERAND,
+                           m_isa.getName(machineIdA) + " " + std::to_string(lineA)),
+        originA.loop};
+}
+
+} /* End namespace as */
@@ -0,0 +1,118 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "kernelgenerator.h"
+#include "myException.h"
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/program_options.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+#include <cstdlib>
+#include <iostream>
+
+int main(int argc, char *argv[])
+{
+    namespace po = boost::program_options;
+    //!< @brief Abbreviation for boost program options library.
+    namespace fs = boost::filesystem;
+    //!< @brief Abbreviation for boost file system library.
+    namespace pt = boost::property_tree;
+    //!< @brief Abbreviation for boost property tree library.
+
+    /* Define command line options for generator.
+       help: Shows cmd-tool options
+       config: Program configuration file with the VCGRA properties. (default=examples/config.xml)
+       output: Path of generated assembler file. (default=std::cout)
+       seed, depth, trips, body, loops, symbols, variables, mix: Parameters of generated program.
+     */
+    as::KernelGenerator::Parameters t_param{};
+
+    po::options_description desc("Usable options");
+    desc.add_options()("help,", "Show command line options and usability.")(
+        "config,", po::value<std::string>()->default_value("examples/config.xml"), "Assembler configuration file.")(
+        "output,", po::value<std::string>(), "Path of generated assembler file (default: std::cout).")(
+        "seed,", po::value<uint64_t>(&t_param.seed)->default_value(t_param.seed), "Seed of random number generator.")(
+        "depth,", po::value<uint32_t>(&t_param.depth)->default_value(t_param.depth), "Nesting depth of loops.")(
+        "trips,", po::value<uint32_t>(&t_param.trips)->default_value(t_param.trips), "Iterations per loop.")(
+        "body,", po::value<uint32_t>(&t_param.body)->default_value(t_param.body), "Commands per loop body.")(
+        "loops,", po::value<uint32_t>(&t_param.loops)->default_value(t_param.loops), "Nested loops per loop body.")(
+        "symbols,", po::value<uint32_t>(&t_param.symbols)->default_value(t_param.symbols), "Number of constants.")(
+        "variables,", po::value<uint32_t>(&t_param.variables)->default_value(t_param.variables),
+        "Number of variables.")("mix,", po::value<std::string>()->default_value("1,2,1,4,3,1"),
+                                "Weights of no, one, two, three operand, arithmetic commands and VAR redefinitions.");
+
+    po::variables_map vm;
+    //!< \brief Variable map to store command line options.
+
+    try
+        {
+            po::store(po::parse_command_line(argc, argv, desc), vm);
+            po::notify(vm);
+        }
+    catch (const po::error &e)
+        {
+            std::cout << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    if (vm.count("help") != 0U)
+        {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+
+    try
+        {
+            pt::ptree t_config{};
+            pt::read_xml(vm["config"].as<std::string>(), t_config);
+
+            t_param.mix = as::KernelGenerator::parseMix(vm["mix"].as<std::string>());
+
+            as::KernelGenerator t_gen{t_config};
+
+            if (vm.count("output") != 0U)
+                {
+                    fs::ofstream t_os{vm["output"].as<std::string>()};
+
+                    if (!t_os)
+                        {
+                            std::cerr << "Cannot open output file " << vm["output"].as<std::string>() << std::endl;
+                            return EXIT_FAILURE;
+                        }
+
+                    t_gen.generate(t_param, t_os);
+                }
+            else
+                t_gen.generate(t_param, std::cout);
+
+            std::cerr << "Generated " << t_gen.getLines() << " lines, " << t_gen.getWords()
+                      << " machine code words after unrolling" << std::endl;
+        }
+    catch (const as::AssemblerException &ce)
+        {
+            std::cerr << ce.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+    catch (const std::exception &e)
+        {
+            std::cerr << "Std. error: " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    return EXIT_SUCCESS;
+}
@@ -27,7 +27,7 @@ IArithmetic::IArithmetic() : IArithmetic{nullptr, "", UINT32_MAX, nullptr, nullp
     return;
 }
 
-IArithmetic::IArithmetic(Level *lvlA, const std::string &cmdLineA, const uint32_t &lineNumberA,
+IArithmetic::IArithmetic(Level *lvlA, const std::string &cmdLineA, const uint64_t &lineNumberA,
                          ParseObjBase *const firstA, ParseObjBase *const secondA)
     : ParseObjBase(lvlA, COMMANDCLASS::ARITHMETIC, cmdLineA, lineNumberA), m_first{firstA}, m_second{secondA}
 {
@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "instructionset.h"
+#include "myException.h"
+#include <boost/property_tree/exceptions.hpp>
+#include <utility>
+
+namespace as
+{
+
+InstructionSet::InstructionSet(const boost::property_tree::ptree &configA)
+{
+    try
+        {
+            m_opCodeSize = configA.get<uint32_t>("Assembler_Property.OpCodeSize");
+            m_placeSize = configA.get<uint32_t>("Assembler_Property.PlaceSize");
+
+            uint32_t t_numOperands{0};
+
+            // Iterate over command classes with machine code
+            for (const char *iter :
+                 {"Assembler_Property.NoOperator", "Assembler_Property.OneOperator", "Assembler_Property.TwoOperator",
+                  "Assembler_Property.ThreeOperator"})
+                {
+                    for (const auto &op : configA.get_child(iter))
+                        {
+                            auto t_name = op.second.get<std::string>("Name");
+                            auto t_id = op.second.get<uint32_t>("MachineId");
+
+                            m_machineIds.emplace(t_name, t_id);
+                            m_operators.emplace(t_id, std::make_pair(t_name, t_numOperands));
+                        }
+
+                    ++t_numOperands;
+                }
+        }
+    catch (boost::property_tree::ptree_error &e)
+        {
+            throw AssemblerException(std::string{"Invalid assembler properties in configuration file: "} + e.what(),
+                                     1005);
+        }
+
+    return;
+}
+
+uint32_t InstructionSet::getMachineId(const std::string &nameA) const
+{
+    auto t_it = m_machineIds.find(nameA);
+
+    return t_it != m_machineIds.end() ? t_it->second : UINT32_MAX;
+}
+
+std::string InstructionSet::getName(const uint32_t machineIdA) const
+{
+    auto t_it = m_operators.find(machineIdA);
+
+    return t_it != m_operators.end() ? t_it->second.first : std::string{};
+}
+
+uint32_t InstructionSet::getNumOperands(const uint32_t machineIdA) const
+{
+    auto t_it = m_operators.find(machineIdA);
+
+    return t_it != m_operators.end() ? t_it->second.second : UINT32_MAX;
+}
+
+uint32_t InstructionSet::getOpCodeSize(void) const
+{
+    return m_opCodeSize;
+}
+
+uint32_t InstructionSet::getMachineCode(const uint64_t wordA) const
+{
+    return wordA & ((1u << m_opCodeSize) - 1);
+}
+
+uint32_t InstructionSet::getPlace(const uint64_t wordA) const
+{
+    return (wordA >> m_opCodeSize) & ((1u << m_placeSize) - 1);
+}
+
+uint32_t InstructionSet::getLine(const uint64_t wordA) const
+{
+    return (wordA & 0xFFFF) >> (m_opCodeSize + m_placeSize);
+}
+
+uint64_t InstructionSet::getAddress(const uint64_t wordA) const
+{
+    return wordA >> 16;
+}
+
+uint64_t InstructionSet::encode(const uint32_t machineIdA, const uint64_t addressA, const uint32_t lineA,
+                                const uint32_t placeA) const
+{
+    uint64_t t_word = static_cast<uint64_t>(lineA) << (m_opCodeSize + m_placeSize);
+    t_word |= static_cast<uint64_t>(placeA) << m_opCodeSize;
+    t_word |= machineIdA;
+
+    return (addressA << 16) | t_word;
+}
+
+uint64_t InstructionSet::encodeLine(const uint32_t machineIdA, const uint64_t addressA, const uint32_t lineA) const
+{
+    // Place of line commands is fixed to 127 in TwoOperand::encode
+    return encode(machineIdA, addressA, lineA, 127);
+}
+
+} /* End namespace as */
@@ -0,0 +1,91 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "instructionstream.h"
+
+namespace as
+{
+
+void InstructionStream::append(const uint64_t wordA, const ParseObjBase *sourceA, const Loop *loopA)
+{
+    m_instructions.push_back(Instruction{wordA, sourceA, loopA});
+
+    return;
+}
+
+const ParseObjBase *InstructionStream::synthesize(const ParseObjBase &originA, const COMMANDCLASS cmdA,
+                                                  const std::string &cmdLineA)
+{
+    m_synthesized.emplace_back(new ParseObjBase(originA.getLevel(), cmdA, cmdLineA, originA.getFileLineNumber()));
+
+    return m_synthesized.back().get();
+}
+
+void InstructionStream::clear(void)
+{
+    m_instructions.clear();
+    m_synthesized.clear();
+
+    return;
+}
+
+uint64_t InstructionStream::size(void) const
+{
+    return m_instructions.size();
+}
+
+bool InstructionStream::empty(void) const
+{
+    return m_instructions.empty();
+}
+
+const Instruction &InstructionStream::at(uint64_t idxA) const
+{
+    return m_instructions.at(idxA);
+}
+
+std::vector<Instruction> &InstructionStream::getInstructions(void)
+{
+    return m_instructions;
+}
+
+const std::vector<Instruction> &InstructionStream::getInstructions(void) const
+{
+    return m_instructions;
+}
+
+InstructionStream::iterator InstructionStream::begin()
+{
+    return m_instructions.begin();
+}
+
+InstructionStream::iterator InstructionStream::end()
+{
+    return m_instructions.end();
+}
+
+InstructionStream::const_iterator InstructionStream::cbegin() const
+{
+    return m_instructions.cbegin();
+}
+
+InstructionStream::const_iterator InstructionStream::cend() const
+{
+    return m_instructions.cend();
+}
+
+} /* End namespace as */
@@ -0,0 +1,218 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "instrumentation.h"
+#include "myException.h"
+#include <algorithm>
+#include <iomanip>
+
+namespace
+{
+
+/**
+ * @brief Names of counters in report.
+ */
+const std::array<const char *, 5> counterNames{
+    {"lines_parsed", "symbol_lookups", "loop_iterations", "words_unrolled", "words_emitted"}};
+
+/**
+ * @brief Names of command classes in report.
+ */
+const std::array<const char *, 10> classNames{{"unknown", "constant", "variable", "no_operand", "one_operand",
+                                               "two_operand", "three_operand", "arithmetic", "loop", "reset_variable"}};
+
+/**
+ * @brief Quote a string for JSON.
+ */
+std::string quote(const std::string &strA)
+{
+    std::string t_str{"\""};
+
+    for (const char c : strA)
+        {
+            if (c == '"' || c == '\\')
+                t_str += '\\';
+
+            t_str += c;
+        }
+
+    return t_str + "\"";
+}
+
+} // end of anonymous namespace
+
+namespace as
+{
+
+thread_local Instrumentation *Instrumentation::current = nullptr;
+
+Instrumentation::Timer::Timer(const std::string &phaseA)
+    : m_phase{phaseA}, m_begin{std::chrono::steady_clock::now()}
+{
+    return;
+}
+
+Instrumentation::Timer::~Timer(void)
+{
+    auto t_end = std::chrono::steady_clock::now();
+    Instrumentation::record(m_phase, std::chrono::duration<double, std::milli>(t_end - m_begin).count());
+}
+
+Instrumentation::Instrumentation(void) : m_phases{}, m_counters{}, m_objects{}
+{
+    return;
+}
+
+Instrumentation::~Instrumentation(void)
+{
+    if (current == this)
+        current = nullptr;
+}
+
+void Instrumentation::setCurrent(Instrumentation *instA)
+{
+    current = instA;
+    return;
+}
+
+Instrumentation *Instrumentation::getCurrent(void)
+{
+    return current;
+}
+
+void Instrumentation::record(const std::string &phaseA, const double millisecondsA)
+{
+    if (!current)
+        return;
+
+    auto t_phase = std::find_if(current->m_phases.begin(), current->m_phases.end(),
+                                [&phaseA](const Phase &phA) { return phA.name == phaseA; });
+
+    if (t_phase == current->m_phases.end())
+        current->m_phases.push_back(Phase{phaseA, 1, millisecondsA});
+    else
+        {
+            ++t_phase->calls;
+            t_phase->milliseconds += millisecondsA;
+        }
+
+    return;
+}
+
+void Instrumentation::merge(const Instrumentation &otherA)
+{
+    for (const auto &phase : otherA.m_phases)
+        {
+            auto t_phase = std::find_if(m_phases.begin(), m_phases.end(),
+                                        [&phase](const Phase &phA) { return phA.name == phase.name; });
+
+            if (t_phase == m_phases.end())
+                m_phases.push_back(phase);
+            else
+                {
+                    t_phase->calls += phase.calls;
+                    t_phase->milliseconds += phase.milliseconds;
+                }
+        }
+
+    for (uint8_t c = 0; c < m_counters.size(); ++c)
+        m_counters[c] += otherA.m_counters[c];
+
+    for (uint8_t c = 0; c < m_objects.size(); ++c)
+        m_objects[c] += otherA.m_objects[c];
+
+    return;
+}
+
+uint64_t Instrumentation::getCounter(const COUNTER counterA) const
+{
+    return m_counters.at(static_cast<uint8_t>(counterA));
+}
+
+double Instrumentation::getMilliseconds(const std::string &phaseA) const
+{
+    for (const auto &phase : m_phases)
+        if (phase.name == phaseA)
+            return phase.milliseconds;
+
+    return 0.0;
+}
+
+bool Instrumentation::isFormat(const std::string &formatA)
+{
+    return formatA == "text" || formatA == "json";
+}
+
+void Instrumentation::report(std::ostream &osA, const std::string &formatA) const
+{
+    if (formatA == "text")
+        writeText(osA);
+    else if (formatA == "json")
+        writeJson(osA);
+    else
+        throw AssemblerException("Unknown statistics format \"" + formatA + "\".", 1011);
+
+    return;
+}
+
+void Instrumentation::writeText(std::ostream &osA) const
+{
+    osA << "Phases:" << std::endl;
+
+    for (const auto &phase : m_phases)
+        osA << "    " << phase.name << ": " << std::fixed << std::setprecision(3) << phase.milliseconds << " ms ("
+            << phase.calls << " calls)" << std::defaultfloat << std::endl;
+
+    osA << "Counters:" << std::endl;
+
+    for (uint8_t c = 0; c < m_counters.size(); ++c)
+        osA << "    " << counterNames[c] << ": " << m_counters[c] << std::endl;
+
+    osA << "Parse objects:" << std::endl;
+
+    for (uint8_t c = 0; c < m_objects.size(); ++c)
+        if (m_objects[c] != 0)
+            osA << "    " << classNames[c] << ": " << m_objects[c] << std::endl;
+
+    return;
+}
+
+void Instrumentation::writeJson(std::ostream &osA) const
+{
+    osA << "{\n  \"phases\": [";
+
+    for (std::size_t p = 0; p < m_phases.size(); ++p)
+        osA << (p != 0 ? "," : "") << "\n    {\"name\": " << quote(m_phases[p].name) << ", \"ms\": " << std::fixed
+            << std::setprecision(3) << m_phases[p].milliseconds << std::defaultfloat
+            << ", \"calls\": " << m_phases[p].calls << "}";
+
+    osA << "\n  ],\n  \"counters\": {";
+
+    for (uint8_t c = 0; c < m_counters.size(); ++c)
+        osA << (c != 0 ? "," : "") << "\n    " << quote(counterNames[c]) << ": " << m_counters[c];
+
+    osA << "\n  },\n  \"parse_objects\": {";
+
+    for (uint8_t c = 0; c < m_objects.size(); ++c)
+        osA << (c != 0 ? "," : "") << "\n    " << quote(classNames[c]) << ": " << m_objects[c];
+
+    osA << "\n  }\n}" << std::endl;
+
+    return;
+}
+
+} /* End namespace as */
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ioutputwriter.h"
+#include "parseobjbase.h"
+#include <cinttypes>
+#include <cstdio>
+
+namespace as
+{
+
+IOutputWriter::IOutputWriter(const boost::property_tree::ptree &configA)
+    : m_include{configA.get<std::string>("General.Include", "")},
+      m_comments{configA.get<bool>("General.Comments", true)}
+{
+    return;
+}
+
+std::string IOutputWriter::toHexString(const uint64_t wordA)
+{
+    // Same layout as format string of IAssemble: address followed by command part, each at least four digits.
+    char t_buf[24];
+    std::snprintf(t_buf, sizeof(t_buf), "0x%04" PRIX64 "%04" PRIX64, wordA >> 16, wordA & 0xFFFF);
+
+    return std::string{t_buf};
+}
+
+std::string IOutputWriter::getGuardName(const boost::filesystem::path &pathA)
+{
+    return pathA.stem().string() + "_H_";
+}
+
+void IOutputWriter::writeInclude(std::ostream &osA) const
+{
+    if (!m_include.empty())
+        osA << "#include \"" << m_include << "\"\n";
+
+    return;
+}
+
+void IOutputWriter::writeStringWord(std::ostream &osA, const Instruction &instA) const
+{
+    osA << "\"" << toHexString(instA.word) << "\",";
+    writeComment(osA, instA);
+
+    return;
+}
+
+void IOutputWriter::writeComment(std::ostream &osA, const Instruction &instA) const
+{
+    if (m_comments)
+        osA << " //" << instA.source->getReadCmdLine();
+
+    osA << '\n';
+
+    return;
+}
+
+} /* End namespace as */
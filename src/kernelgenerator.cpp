@@ -0,0 +1,375 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "kernelgenerator.h"
+#include "myException.h"
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+
+namespace as
+{
+
+KernelGenerator::KernelGenerator(const boost::property_tree::ptree &configA)
+    : m_limit{0}, m_dicLines{configA.get<uint32_t>("VCGRA_Property.Num_Dic_Lines", 1)},
+      m_dicPlaces{configA.get<uint32_t>("VCGRA_Property.Num_Dic_Places", 1)},
+      m_docLines{configA.get<uint32_t>("VCGRA_Property.Num_Doc_Lines", 1)},
+      m_docPlaces{configA.get<uint32_t>("VCGRA_Property.Num_Doc_Places", 1)},
+      m_pcLines{configA.get<uint32_t>("VCGRA_Property.Num_PC_Lines", 1)},
+      m_ccLines{configA.get<uint32_t>("VCGRA_Property.Num_CC_Lines", 1)}, m_param{}, m_symbols{}, m_initial{},
+      m_rng{}, m_lines{0}, m_words{0}
+{
+    const auto t_memory = configA.get_optional<int64_t>("VCGRA_Property.Available_Memory");
+
+    if (!t_memory)
+        throw AssemblerException("Generator: Available_Memory is missing in configuration file", 1012);
+
+    // Largest data transfer is a complete line
+    const int64_t t_transfer =
+        std::max<int64_t>(m_dicPlaces * configA.get<int64_t>("VCGRA_Property.Dic_Place_Stride", 1),
+                          m_docPlaces * configA.get<int64_t>("VCGRA_Property.Doc_Place_Stride", 1));
+
+    m_limit = *t_memory - t_transfer;
+
+    if (m_limit < 256 || m_dicLines == 0 || m_dicPlaces == 0 || m_docLines == 0 || m_docPlaces == 0 ||
+        m_pcLines == 0 || m_ccLines == 0)
+        throw AssemblerException("Generator: VCGRA properties are too small for generated programs", 1012);
+
+    return;
+}
+
+uint64_t KernelGenerator::random(const uint64_t boundA)
+{
+    return boundA != 0 ? m_rng() % boundA : 0;
+}
+
+std::array<uint32_t, static_cast<uint8_t>(KernelGenerator::MIX::NUM_MIX)>
+KernelGenerator::parseMix(const std::string &mixA)
+{
+    std::array<uint32_t, static_cast<uint8_t>(MIX::NUM_MIX)> t_mix{};
+    std::istringstream t_is{mixA};
+    std::string t_item{};
+    std::size_t t_count{0};
+
+    while (std::getline(t_is, t_item, ','))
+        {
+            if (t_count == t_mix.size() || t_item.empty() ||
+                t_item.find_first_not_of("0123456789") != std::string::npos)
+                throw AssemblerException("Generator: Malformed command mix \"" + mixA + "\"", 1013);
+
+            t_mix[t_count++] = static_cast<uint32_t>(std::stoul(t_item));
+        }
+
+    if (t_count != t_mix.size())
+        throw AssemblerException("Generator: Command mix \"" + mixA + "\" needs six weights", 1013);
+
+    return t_mix;
+}
+
+void KernelGenerator::generate(const Parameters &paramA, std::ostream &osA)
+{
+    m_param = paramA;
+    m_rng.seed(m_param.seed);
+    m_lines = m_words = 0;
+
+    // Variables are required for arithmetic commands and redefinitions
+    if (m_param.variables == 0)
+        m_param.mix[static_cast<uint8_t>(MIX::ARITHMETIC)] = m_param.mix[static_cast<uint8_t>(MIX::RESETVAR)] = 0;
+
+    if (std::accumulate(m_param.mix.begin(), m_param.mix.end(), uint64_t{0}) == 0)
+        throw AssemblerException("Generator: All weights of command mix are zero", 1013);
+
+    if (m_param.symbols == 0 && m_param.variables == 0)
+        throw AssemblerException("Generator: Memory commands need at least one constant or variable", 1013);
+
+    if (m_param.trips == 0)
+        throw AssemblerException("Generator: Loops need at least one iteration", 1013);
+
+    osA << "# Generated program: seed " << m_param.seed << ", depth " << m_param.depth << ", trips "
+        << m_param.trips << ", body " << m_param.body << ", loops " << m_param.loops << ", symbols "
+        << m_param.symbols << ", variables " << m_param.variables << "\n";
+    ++m_lines;
+
+    m_symbols.clear();
+    m_initial.clear();
+
+    for (uint32_t s = 0; s < m_param.symbols; ++s)
+        {
+            m_symbols.push_back(static_cast<int64_t>(random(m_limit / 2)) * 2);
+            osA << "CONST c" << s << " " << m_symbols.back() << "\n";
+            ++m_lines;
+        }
+
+    for (uint32_t v = 0; v < m_param.variables; ++v)
+        {
+            m_initial.push_back(static_cast<int64_t>(random(m_limit / 2)) * 2);
+            osA << "VAR v" << v << " " << m_initial.back() << "\n";
+            ++m_lines;
+        }
+
+    // Line 0 of all caches is selected at program start
+    State t_state{m_initial, false, {{0, 0, 0, 0}}, {{0, 0, 0, 0}}};
+    writeBody(osA, t_state, 0, 1);
+
+    osA << "FINISH\n";
+    ++m_lines;
+    ++m_words;
+
+    return;
+}
+
+void KernelGenerator::writeBody(std::ostream &osA, State &stateA, const uint32_t depthA, const uint64_t multiplicityA)
+{
+    const std::string t_indent(4 * depthA, ' ');
+
+    // All iterations of a loop start with the same variable values
+    if (depthA > 0)
+        {
+            for (uint32_t v = 0; v < m_param.variables; ++v)
+                osA << t_indent << "VAR v" << v << " " << m_initial[v] << "\n";
+
+            m_lines += m_param.variables;
+            stateA.values = m_initial;
+
+            // Selections differ between first and further iterations
+            stateA.selected.fill(UINT32_MAX);
+        }
+
+    // Positions of nested loops between the commands of the body
+    std::vector<uint32_t> t_loops{};
+
+    if (depthA < m_param.depth)
+        for (uint32_t l = 0; l < m_param.loops; ++l)
+            t_loops.push_back(static_cast<uint32_t>(random(m_param.body + 1)));
+
+    std::sort(t_loops.begin(), t_loops.end());
+
+    auto t_nextLoop = t_loops.cbegin();
+
+    for (uint32_t c = 0; c <= m_param.body; ++c)
+        {
+            for (; t_nextLoop != t_loops.cend() && *t_nextLoop == c; ++t_nextLoop)
+                {
+                    complete(osA, stateA, t_indent, multiplicityA);
+
+                    osA << t_indent << "LOOP 0 " << m_param.trips << " 1\n";
+                    ++m_lines;
+
+                    writeBody(osA, stateA, depthA + 1, multiplicityA * m_param.trips);
+
+                    osA << t_indent << "POOL\n";
+                    ++m_lines;
+                }
+
+            if (c < m_param.body)
+                writeCommand(osA, stateA, t_indent, multiplicityA);
+        }
+
+    complete(osA, stateA, t_indent, multiplicityA);
+
+    return;
+}
+
+void KernelGenerator::complete(std::ostream &osA, State &stateA, const std::string &indentA,
+                               const uint64_t multiplicityA, const uint8_t cacheA, const uint32_t lineA)
+{
+    if (!stateA.running)
+        return;
+
+    if (cacheA < stateA.busy.size() && stateA.busy[cacheA] != UINT32_MAX && stateA.busy[cacheA] != lineA)
+        return;
+
+    osA << indentA << "WAIT_READY\n";
+    ++m_lines;
+    m_words += multiplicityA;
+    stateA.running = false;
+
+    return;
+}
+
+void KernelGenerator::writeCommand(std::ostream &osA, State &stateA, const std::string &indentA,
+                                   const uint64_t multiplicityA)
+{
+    // Select command class by weight
+    uint64_t t_pick = random(std::accumulate(m_param.mix.begin(), m_param.mix.end(), uint64_t{0}));
+    uint8_t t_class{0};
+
+    for (; t_pick >= m_param.mix[t_class]; ++t_class)
+        t_pick -= m_param.mix[t_class];
+
+    const std::array<uint32_t, 4> t_lines{{m_dicLines, m_docLines, m_pcLines, m_ccLines}};
+
+    switch (static_cast<MIX>(t_class))
+        {
+        case MIX::NOOPERAND:
+            if (random(3) == 0)
+                osA << indentA << "NOOP\n";
+            else if (stateA.running)
+                {
+                    osA << indentA << "WAIT_READY\n";
+                    stateA.running = false;
+                }
+            else
+                {
+                    osA << indentA << "START\n";
+                    stateA.running = true;
+                    stateA.busy = stateA.selected;
+                }
+            break;
+        case MIX::ONEOPERAND:
+            {
+                const uint8_t t_cache = static_cast<uint8_t>(random(4));
+                const uint32_t t_line = static_cast<uint32_t>(random(t_lines[t_cache]));
+                const std::array<const char *, 4> t_names{
+                    {"SLCT_DIC_LINE ", "SLCT_DOC_LINE ", "SLCT_PECC_LINE ", "SLCT_CHCC_LINE "}};
+
+                // Every select changes the running computation
+                complete(osA, stateA, indentA, multiplicityA);
+                osA << indentA << t_names[t_cache] << t_line << "\n";
+                stateA.selected[t_cache] = t_line;
+            }
+            break;
+        case MIX::TWOOPERAND:
+            {
+                const uint8_t t_cache = static_cast<uint8_t>(random(4));
+                const uint32_t t_line = static_cast<uint32_t>(random(t_lines[t_cache]));
+                const std::array<const char *, 4> t_names{{"LOADDA ", "STOREDA ", "LOADPC ", "LOADCC "}};
+
+                complete(osA, stateA, indentA, multiplicityA, t_cache, t_line);
+                osA << indentA << t_names[t_cache] << getAddress() << " " << t_line << "\n";
+            }
+            break;
+        case MIX::THREEOPERAND:
+            {
+                // Loads are more frequent than stores
+                const uint8_t t_cache = random(3) != 0 ? 0 : 1;
+                const uint32_t t_line = static_cast<uint32_t>(random(t_lines[t_cache]));
+                const uint64_t t_place = random(t_cache == 0 ? m_dicPlaces : m_docPlaces);
+
+                complete(osA, stateA, indentA, multiplicityA, t_cache, t_line);
+                osA << indentA << (t_cache == 0 ? "LOADD " : "STORED ") << getAddress() << " " << t_line << " "
+                    << t_place << "\n";
+            }
+            break;
+        case MIX::ARITHMETIC:
+            writeArithmetic(osA, stateA, indentA);
+            ++m_lines;
+            return;
+        case MIX::RESETVAR:
+        default:
+            {
+                const uint64_t t_var = random(m_param.variables);
+
+                stateA.values[t_var] = static_cast<int64_t>(random(m_limit / 2)) * 2;
+                osA << indentA << "VAR v" << t_var << " " << stateA.values[t_var] << "\n";
+                ++m_lines;
+            }
+            return;
+        }
+
+    ++m_lines;
+    m_words += multiplicityA;
+
+    return;
+}
+
+void KernelGenerator::writeArithmetic(std::ostream &osA, State &stateA, const std::string &indentA)
+{
+    const uint64_t t_var = random(m_param.variables);
+    const int64_t t_value = stateA.values[t_var];
+    const int64_t t_step = static_cast<int64_t>(random(32) + 1) * 2;
+
+    // Second operand of register commands is a constant or a variable
+    const uint64_t t_operand = random(m_param.symbols + m_param.variables);
+    const bool t_isSymbol = t_operand < m_param.symbols;
+    const int64_t t_other = t_isSymbol ? m_symbols[t_operand] : stateA.values[t_operand - m_param.symbols];
+    const std::string t_name = t_isSymbol ? "c" + std::to_string(t_operand)
+                                          : "v" + std::to_string(t_operand - m_param.symbols);
+
+    std::string t_cmd{};
+    int64_t t_result{-1};
+
+    switch (random(6))
+        {
+        case 0:
+            t_cmd = "ADDI v" + std::to_string(t_var) + " " + std::to_string(t_step);
+            t_result = t_value + t_step;
+            break;
+        case 1:
+            t_cmd = "SUBI v" + std::to_string(t_var) + " " + std::to_string(t_step);
+            t_result = t_value - t_step;
+            break;
+        case 2:
+            t_cmd = "MULI v" + std::to_string(t_var) + " 2";
+            t_result = t_value * 2;
+            break;
+        case 3:
+            t_cmd = "ADD v" + std::to_string(t_var) + " " + t_name;
+            t_result = t_value + t_other;
+            break;
+        case 4:
+            t_cmd = "SUB v" + std::to_string(t_var) + " " + t_name;
+            t_result = t_value - t_other;
+            break;
+        default:
+            t_cmd = "MUL v" + std::to_string(t_var) + " " + t_name;
+            t_result = t_value * t_other;
+            break;
+        }
+
+    // Keep address variables in range of shared memory
+    if (t_result < 0 || t_result > m_limit)
+        {
+            if (t_value + t_step <= m_limit)
+                {
+                    t_cmd = "ADDI v" + std::to_string(t_var) + " " + std::to_string(t_step);
+                    t_result = t_value + t_step;
+                }
+            else
+                {
+                    t_cmd = "SUBI v" + std::to_string(t_var) + " " + std::to_string(t_step);
+                    t_result = t_value - t_step;
+                }
+        }
+
+    stateA.values[t_var] = t_result;
+    osA << indentA << t_cmd << "\n";
+
+    return;
+}
+
+std::string KernelGenerator::getAddress(void)
+{
+    const uint64_t t_symbol = random(m_param.symbols + m_param.variables);
+
+    if (t_symbol < m_param.symbols)
+        return "c" + std::to_string(t_symbol);
+
+    return "v" + std::to_string(t_symbol - m_param.symbols);
+}
+
+uint64_t KernelGenerator::getLines(void) const
+{
+    return m_lines;
+}
+
+uint64_t KernelGenerator::getWords(void) const
+{
+    return m_words;
+}
+
+} /* End namespace as */
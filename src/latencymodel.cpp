@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "latencymodel.h"
+#include "myException.h"
+#include <algorithm>
+#include <array>
+#include <utility>
+
+namespace as
+{
+
+LatencyModel::LatencyModel(const InstructionSet &isaA, const boost::property_tree::ptree &configA)
+    : m_latencies(1u << isaA.getOpCodeSize(), configA.get<uint64_t>("Timing.Default", 1)),
+      m_default{configA.get<uint64_t>("Timing.Default", 1)}, m_fabric{configA.get<uint64_t>("Timing.Fabric", 1)},
+      m_start{isaA.getMachineId("START")},
+      m_wait{isaA.getMachineId("WAIT_READY")}, m_isa{isaA}
+{
+    const auto t_timing = configA.get_child_optional("Timing");
+
+    if (!t_timing)
+        return;
+
+    for (const auto &entry : *t_timing)
+        {
+            if (entry.first != "Latency")
+                continue;
+
+            const auto t_name = entry.second.get<std::string>("Name");
+            const auto t_id = m_isa.getMachineId(t_name);
+
+            if (t_id >= m_latencies.size())
+                throw AssemblerException("Timing: Unknown command " + t_name, 1010);
+
+            m_latencies[t_id] = entry.second.get<uint64_t>("Cycles");
+        }
+
+    // Transfer time of data cache commands
+    const auto t_bandwidth = configA.get<uint64_t>("Timing.Bandwidth", 0);
+
+    if (t_bandwidth == 0)
+        return;
+
+    const uint64_t t_dicStride = std::max<uint64_t>(configA.get<uint64_t>("VCGRA_Property.Dic_Place_Stride", 1), 1);
+    const uint64_t t_docStride = std::max<uint64_t>(configA.get<uint64_t>("VCGRA_Property.Doc_Place_Stride", 1), 1);
+    const uint64_t t_dicLine = configA.get<uint64_t>("VCGRA_Property.Num_Dic_Places", 0) * t_dicStride;
+    const uint64_t t_docLine = configA.get<uint64_t>("VCGRA_Property.Num_Doc_Places", 0) * t_docStride;
+
+    const std::array<std::pair<const char *, uint64_t>, 4> t_transfers{
+        {{"LOADD", t_dicStride}, {"LOADDA", t_dicLine}, {"STORED", t_docStride}, {"STOREDA", t_docLine}}};
+
+    for (const auto &transfer : t_transfers)
+        {
+            const auto t_id = m_isa.getMachineId(transfer.first);
+
+            if (t_id < m_latencies.size())
+                m_latencies[t_id] += (transfer.second + t_bandwidth - 1) / t_bandwidth;
+        }
+
+    return;
+}
+
+uint64_t LatencyModel::getLatency(const uint32_t machineIdA) const
+{
+    return machineIdA < m_latencies.size() ? m_latencies[machineIdA] : m_default;
+}
+
+uint64_t LatencyModel::getStart(const State &stateA, const uint64_t wordA) const
+{
+    if (m_isa.getMachineCode(wordA) == m_wait)
+        return std::max(stateA.cycle, stateA.fabricReady);
+
+    return stateA.cycle;
+}
+
+uint64_t LatencyModel::getFabric(void) const
+{
+    return m_fabric;
+}
+
+void LatencyModel::issue(State &stateA, const uint64_t wordA) const
+{
+    issueCommand(stateA, m_isa.getMachineCode(wordA));
+
+    return;
+}
+
+void LatencyModel::issueCommand(State &stateA, const uint32_t machineIdA) const
+{
+    if (machineIdA == m_wait)
+        stateA.cycle = std::max(stateA.cycle, stateA.fabricReady) + getLatency(machineIdA);
+    else if (machineIdA == m_start)
+        {
+            // Computation runs in parallel until WAIT_READY
+            stateA.fabricReady = std::max(stateA.cycle, stateA.fabricReady) + m_fabric;
+            stateA.cycle += getLatency(machineIdA);
+        }
+    else
+        stateA.cycle += getLatency(machineIdA);
+
+    return;
+}
+
+uint64_t LatencyModel::estimate(const std::vector<Instruction> &instsA) const
+{
+    State t_state{0, 0};
+
+    for (const auto &inst : instsA)
+        issue(t_state, inst.word);
+
+    return std::max(t_state.cycle, t_state.fabricReady);
+}
+
+} /* End namespace as */
@@ -16,6 +16,7 @@
  */
 
 #include "level.h"
+#include "instrumentation.h"
 #include "myException.h"
 #include "parseobjectconst.h"
 #include "parseobjectvariable.h"
@@ -30,21 +31,29 @@ as::Level &operator<<(as::Level &lvlA, as::ParseObjBase *parseObjA)
     return lvlA;
 }
 
-namespace as
+namespace
 {
 
-Level *Level::activeLvl = nullptr;
-
-void Level::setCurrentLevel(Level *lvlA)
+/**
+ * @brief Get name of a constant or variable.
+ *
+ * @param[in] pObjA Parse object.
+ * @return Pointer to name, nullptr if parse object is no constant or variable.
+ */
+const std::string *getSymbolName(const as::ParseObjBase *pObjA)
 {
-    Level::activeLvl = lvlA;
-    return;
+    if (pObjA->getCommandClass() == as::COMMANDCLASS::VARIABLE)
+        return &static_cast<const as::ParseObjectVariable *>(pObjA)->getVariableName();
+    else if (pObjA->getCommandClass() == as::COMMANDCLASS::CONSTANT)
+        return &static_cast<const as::ParseObjectConst *>(pObjA)->getConstName();
+    else
+        return nullptr;
 }
 
-Level *Level::getCurrentLevel()
+} // end of anonymous namespace
+
+namespace as
 {
-    return Level::activeLvl;
-}
 
 Level::Level() : m_parentLvl{nullptr} {}
 
@@ -66,6 +75,8 @@ Level &Level::operator=(Level &&src)
     src.m_childLvlVec.clear();
     this->m_parsedObjVec = src.m_parsedObjVec;
     src.m_parsedObjVec.clear();
+    this->m_symbolMap = std::move(src.m_symbolMap);
+    src.m_symbolMap.clear();
 
     return *this;
 }
@@ -78,6 +89,8 @@ Level::Level(Level &&src)
     src.m_childLvlVec.clear();
     this->m_parsedObjVec = src.m_parsedObjVec;
     src.m_parsedObjVec.clear();
+    this->m_symbolMap = std::move(src.m_symbolMap);
+    src.m_symbolMap.clear();
 
     return;
 }
@@ -97,6 +110,36 @@ uint8_t Level::addParseObj(ParseObjBase *pObjA)
     if (pObjA)
         {
             m_parsedObjVec.push_back(pObjA);
+
+            // Lookup finds the first symbol of a name
+            const std::string *t_name = getSymbolName(pObjA);
+            if (t_name)
+                m_symbolMap.emplace(*t_name, pObjA);
+
+            return 0;
+        }
+    else
+        return 1;
+}
+
+uint8_t Level::insertParseObj(uint64_t idxA, ParseObjBase *pObjA)
+{
+    if (pObjA && idxA <= m_parsedObjVec.size())
+        {
+            m_parsedObjVec.insert(m_parsedObjVec.begin() + idxA, pObjA);
+
+            const std::string *t_name = getSymbolName(pObjA);
+            if (t_name)
+                {
+                    auto t_entry = m_symbolMap.emplace(*t_name, pObjA);
+
+                    // Replace indexed symbol of same name, if it follows the inserted one
+                    if (!t_entry.second &&
+                        std::find(m_parsedObjVec.begin(), m_parsedObjVec.begin() + idxA, t_entry.first->second) ==
+                            m_parsedObjVec.begin() + idxA)
+                        t_entry.first->second = pObjA;
+                }
+
             return 0;
         }
     else
@@ -108,7 +151,7 @@ const std::vector<ParseObjBase *> &Level::getParseObjList() const
     return m_parsedObjVec;
 }
 
-ParseObjBase *Level::getParseObj(uint32_t idxA) const
+ParseObjBase *Level::getParseObj(uint64_t idxA) const
 {
     try
         {
@@ -131,6 +174,7 @@ uint8_t Level::clearParseObjList()
             for (auto *item : m_parsedObjVec)
                 delete item;
             m_parsedObjVec.clear();
+            m_symbolMap.clear();
             return 0;
         }
     catch (std::exception &e)
@@ -139,13 +183,32 @@ uint8_t Level::clearParseObjList()
         }
 }
 
-ParseObjBase *Level::deleteParseObj(uint32_t idxA)
+ParseObjBase *Level::deleteParseObj(uint64_t idxA)
 {
     try
         {
             ParseObjBase *tPtr;
             tPtr = m_parsedObjVec.at(idxA);
             m_parsedObjVec.erase(m_parsedObjVec.begin() + idxA);
+
+            // Index next symbol of same name, if any
+            const std::string *t_name = getSymbolName(tPtr);
+            auto t_symbol = t_name ? m_symbolMap.find(*t_name) : m_symbolMap.end();
+            if (t_symbol != m_symbolMap.end() && t_symbol->second == tPtr)
+                {
+                    m_symbolMap.erase(t_symbol);
+
+                    for (auto *parseObj : m_parsedObjVec)
+                        {
+                            const std::string *t_other = getSymbolName(parseObj);
+                            if (t_other && *t_other == *t_name)
+                                {
+                                    m_symbolMap.emplace(*t_other, parseObj);
+                                    break;
+                                }
+                        }
+                }
+
             return tPtr;
         }
     catch (std::out_of_range &e)
@@ -160,31 +223,14 @@ ParseObjBase *Level::deleteParseObj(uint32_t idxA)
 
 ParseObjBase *Level::findParseObj(const std::string &nameA)
 {
+    Instrumentation::count(Instrumentation::COUNTER::SYMBOL_LOOKUPS);
 
     ParseObjBase *t_parseObj = nullptr;
 
     // Search for variable in current level
-    for (auto *parseObj : m_parsedObjVec)
-        {
-            if (parseObj->getCommandClass() == COMMANDCLASS::VARIABLE)
-                {
-                    if (*(static_cast<ParseObjectVariable *>(parseObj)) == nameA)
-                        {
-                            t_parseObj = parseObj;
-                            break;
-                        }
-                }
-            else if (parseObj->getCommandClass() == COMMANDCLASS::CONSTANT)
-                {
-                    if (*(static_cast<ParseObjectConst *>(parseObj)) == nameA)
-                        {
-                            t_parseObj = parseObj;
-                            break;
-                        }
-                }
-            else
-                continue;
-        }
+    auto t_symbol = m_symbolMap.find(nameA);
+    if (t_symbol != m_symbolMap.end())
+        t_parseObj = t_symbol->second;
 
     // Look for variable in parent level
     if (!t_parseObj)
@@ -198,10 +244,9 @@ ParseObjBase *Level::findParseObj(const std::string &nameA)
     return t_parseObj;
 }
 
-void Level::leave(void)
+Level *Level::leave(void) const
 {
-    Level::setCurrentLevel(m_parentLvl);
-    return;
+    return m_parentLvl;
 }
 
 bool operator==(const Level &lhsA, const Level &rhsA)
@@ -268,7 +313,7 @@ std::vector<Level *>::const_iterator Level::cend() const
     return m_childLvlVec.cend();
 }
 
-Level *Level::at(uint32_t lvlId) const
+Level *Level::at(uint64_t lvlId) const
 {
     return m_childLvlVec.at(lvlId);
 }
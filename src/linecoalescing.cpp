@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "linecoalescing.h"
+#include <unordered_map>
+
+namespace as
+{
+
+LineCoalescing::LineCoalescing(const InstructionSet &isaA, const std::string &placeNameA,
+                               const std::string &lineNameA, const uint32_t numPlacesA, const uint64_t strideA,
+                               const uint64_t memorySizeA, const bool mergeAtFirstA)
+    : m_isa{isaA}, m_placeId{isaA.getMachineId(placeNameA)}, m_lineId{isaA.getMachineId(lineNameA)},
+      m_numPlaces{numPlacesA}, m_stride{strideA}, m_lineName{lineNameA}, m_memorySize{memorySizeA},
+      m_mergeAtFirst{mergeAtFirstA}
+{
+    return;
+}
+
+uint64_t LineCoalescing::run(InstructionStream &streamA)
+{
+    // Pass is not applicable for instruction set
+    if (m_placeId == UINT32_MAX || m_lineId == UINT32_MAX || m_numPlaces == 0)
+        return 0;
+
+    std::vector<Instruction> &t_insts = streamA.getInstructions();
+    std::vector<bool> t_remove(t_insts.size(), false);
+    std::unordered_map<uint32_t, Run> t_runs{};
+    uint64_t t_removed{0};
+
+    for (uint64_t i = 0; i < t_insts.size(); ++i)
+        {
+            const auto t_word = t_insts[i].word;
+            const bool t_isPlaceCmd = m_isa.getMachineCode(t_word) == m_placeId;
+            const auto t_line = m_isa.getLine(t_word);
+
+            // Drop open runs which cannot be continued behind this instruction
+            for (auto it = t_runs.begin(); it != t_runs.end();)
+                {
+                    if ((!t_isPlaceCmd || it->first != t_line) && isBarrier(t_insts[i], it->first, it->second.base))
+                        it = t_runs.erase(it);
+                    else
+                        ++it;
+                }
+
+            if (!t_isPlaceCmd)
+                continue;
+
+            const auto t_place = m_isa.getPlace(t_word);
+            const auto t_address = m_isa.getAddress(t_word);
+
+            auto t_it = t_runs.find(t_line);
+
+            if (t_it == t_runs.end() || !addToRun(t_it->second, i, t_place, t_address))
+                {
+                    // Start new run, if the command can be part of a whole-line command
+                    t_runs.erase(t_line);
+
+                    if (t_place >= m_numPlaces || t_address < t_place * m_stride)
+                        continue;
+
+                    t_it = t_runs.emplace(t_line, Run{{}, std::vector<bool>(m_numPlaces, false),
+                                                      t_address - t_place * m_stride})
+                               .first;
+                    addToRun(t_it->second, i, t_place, t_address);
+                }
+
+            auto &t_run = t_it->second;
+
+            if (t_run.indices.size() == m_numPlaces)
+                {
+                    if (t_run.base < m_memorySize)
+                        {
+                            auto &t_inst = t_insts[m_mergeAtFirst ? t_run.indices.front() : t_run.indices.back()];
+
+                            t_inst.word = m_isa.encodeLine(m_lineId, t_run.base, t_line);
+                            t_inst.source =
+                                streamA.synthesize(*t_inst.source, COMMANDCLASS::TWOOPERAND,
+                                                   m_lineName + " " + std::to_string(t_run.base) + " " +
+                                                       std::to_string(t_line));
+
+                            for (auto idx : t_run.indices)
+                                t_remove[idx] = true;
+                            t_remove[m_mergeAtFirst ? t_run.indices.front() : t_run.indices.back()] = false;
+
+                            t_removed += m_numPlaces - 1;
+                            coalesced(t_inst, m_numPlaces - 1);
+                        }
+
+                    t_runs.erase(t_it);
+                }
+        }
+
+    // Remove coalesced commands from stream
+    auto t_out = t_insts.begin();
+
+    for (uint64_t i = 0; i < t_insts.size(); ++i)
+        {
+            if (!t_remove[i])
+                *t_out++ = t_insts[i];
+        }
+
+    t_insts.erase(t_out, t_insts.end());
+
+    return t_removed;
+}
+
+void LineCoalescing::coalesced(const Instruction &, const uint64_t)
+{
+    return;
+}
+
+bool LineCoalescing::addToRun(Run &runA, const uint64_t idxA, const uint32_t placeA, const uint64_t addressA) const
+{
+    if (placeA >= m_numPlaces || runA.places[placeA] || addressA != runA.base + placeA * m_stride)
+        return false;
+
+    runA.places[placeA] = true;
+    runA.indices.push_back(idxA);
+
+    return true;
+}
+
+} /* End namespace as */
@@ -0,0 +1,320 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "listscheduler.h"
+#include <algorithm>
+
+namespace as
+{
+
+ListScheduler::ListScheduler(const InstructionSet &isaA, const boost::property_tree::ptree &configA)
+    : m_model{isaA, configA}, m_window{std::max<std::size_t>(configA.get<std::size_t>("Timing.Window", 64), 1)},
+      m_dicPlaces{configA.get<uint64_t>("VCGRA_Property.Num_Dic_Places", 0)},
+      m_docPlaces{configA.get<uint64_t>("VCGRA_Property.Num_Doc_Places", 0)},
+      m_dicStride{std::max<uint64_t>(configA.get<uint64_t>("VCGRA_Property.Dic_Place_Stride", 1), 1)},
+      m_docStride{std::max<uint64_t>(configA.get<uint64_t>("VCGRA_Property.Doc_Place_Stride", 1), 1)},
+      m_selectIds{{isaA.getMachineId("SLCT_DIC_LINE"), isaA.getMachineId("SLCT_DOC_LINE"),
+                   isaA.getMachineId("SLCT_PECC_LINE"), isaA.getMachineId("SLCT_CHCC_LINE")}},
+      m_start{isaA.getMachineId("START")}, m_wait{isaA.getMachineId("WAIT_READY")},
+      m_loadd{isaA.getMachineId("LOADD")}, m_loadda{isaA.getMachineId("LOADDA")},
+      m_stored{isaA.getMachineId("STORED")}, m_storeda{isaA.getMachineId("STOREDA")},
+      m_loadpc{isaA.getMachineId("LOADPC")}, m_loadcc{isaA.getMachineId("LOADCC")}, m_regions{0},
+      m_cyclesBefore{0}, m_cyclesAfter{0}, m_isa{isaA}
+{
+    m_selected.fill(UINT32_MAX);
+
+    return;
+}
+
+std::string ListScheduler::getName(void) const
+{
+    return "list-scheduler";
+}
+
+uint64_t ListScheduler::run(InstructionStream &streamA)
+{
+    std::vector<Instruction> &t_insts = streamA.getInstructions();
+    std::vector<std::vector<Access>> t_access{};
+    LatencyModel::State t_state{0, 0};
+    uint64_t t_moved{0};
+
+    m_regions = 0;
+    m_selected.fill(UINT32_MAX);
+    m_running.clear();
+    m_cyclesBefore = m_model.estimate(t_insts);
+
+    std::size_t i{0};
+
+    while (i < t_insts.size())
+        {
+            std::size_t j{i};
+            t_access.clear();
+
+            // Collect region of same innermost loop up to the next barrier
+            while (j < t_insts.size() && j - i < m_window && t_insts[j].loop == t_insts[i].loop)
+                {
+                    std::vector<Access> t_acc{};
+
+                    if (!getAccesses(t_insts[j].word, t_acc))
+                        break;
+
+                    t_access.push_back(std::move(t_acc));
+                    ++j;
+                }
+
+            if (j == i)
+                {
+                    // Barrier keeps its position
+                    m_model.issue(t_state, t_insts[i].word);
+                    ++i;
+                    continue;
+                }
+
+            const auto t_regionMoved = schedule(t_insts, i, t_access, t_state);
+
+            if (t_regionMoved > 0)
+                ++m_regions;
+
+            t_moved += t_regionMoved;
+            i = j;
+        }
+
+    m_cyclesAfter = m_model.estimate(t_insts);
+
+    return t_moved;
+}
+
+void ListScheduler::report(std::ostream &osA) const
+{
+    osA << "    Reordered regions: " << m_regions << std::endl;
+    osA << "    Estimated cycles: " << m_cyclesBefore << " -> " << m_cyclesAfter << std::endl;
+
+    return;
+}
+
+bool ListScheduler::getAccesses(const uint64_t wordA, std::vector<Access> &accessA)
+{
+    const auto t_id = m_isa.getMachineCode(wordA);
+    const auto t_line = m_isa.getLine(wordA);
+    const auto t_place = m_isa.getPlace(wordA);
+    const auto t_addr = m_isa.getAddress(wordA);
+
+    if (t_id == UINT32_MAX)
+        return false;
+
+    if (t_id == m_start)
+        {
+            // Computation reads selected input and configuration lines and writes selected output line
+            accessA.push_back(Access{RESOURCE::SELECT, 0, m_selectIds.size(), false});
+            accessA.push_back(getLine(RESOURCE::DIC, m_selected[0], m_dicPlaces, false));
+            accessA.push_back(getLine(RESOURCE::DOC, m_selected[1], m_docPlaces, true));
+            accessA.push_back(getLine(RESOURCE::PC, m_selected[2], 0, false));
+            accessA.push_back(getLine(RESOURCE::CC, m_selected[3], 0, false));
+            m_running = accessA;
+            accessA.push_back(Access{RESOURCE::FABRIC, 0, 1, true});
+        }
+    else if (t_id == m_wait)
+        {
+            // Accesses of the computation last until WAIT_READY
+            accessA = m_running;
+            accessA.push_back(Access{RESOURCE::FABRIC, 0, 1, true});
+            m_running.clear();
+        }
+    else if (t_id == m_loadd)
+        {
+            const auto t_cell = m_dicPlaces > 0 ? t_line * m_dicPlaces + t_place : t_line;
+            accessA.push_back(Access{RESOURCE::MEMORY, t_addr, t_addr + m_dicStride, false});
+            accessA.push_back(Access{RESOURCE::DIC, t_cell, t_cell + 1, true});
+        }
+    else if (t_id == m_loadda)
+        {
+            accessA.push_back(
+                Access{RESOURCE::MEMORY, t_addr, t_addr + std::max<uint64_t>(m_dicPlaces, 1) * m_dicStride, false});
+            accessA.push_back(getLine(RESOURCE::DIC, t_line, m_dicPlaces, true));
+        }
+    else if (t_id == m_stored)
+        {
+            const auto t_cell = m_docPlaces > 0 ? t_line * m_docPlaces + t_place : t_line;
+            accessA.push_back(Access{RESOURCE::DOC, t_cell, t_cell + 1, false});
+            accessA.push_back(Access{RESOURCE::MEMORY, t_addr, t_addr + m_docStride, true});
+        }
+    else if (t_id == m_storeda)
+        {
+            accessA.push_back(getLine(RESOURCE::DOC, t_line, m_docPlaces, false));
+            accessA.push_back(
+                Access{RESOURCE::MEMORY, t_addr, t_addr + std::max<uint64_t>(m_docPlaces, 1) * m_docStride, true});
+        }
+    else if (t_id == m_loadpc || t_id == m_loadcc)
+        {
+            // Size of configuration bitstreams is unknown, thus they may depend on all stores
+            accessA.push_back(Access{RESOURCE::MEMORY, 0, UINT64_MAX, false});
+            accessA.push_back(getLine(t_id == m_loadpc ? RESOURCE::PC : RESOURCE::CC, t_line, 0, true));
+        }
+    else
+        {
+            const auto t_it = std::find(m_selectIds.begin(), m_selectIds.end(), t_id);
+
+            // NOOP, FINISH and unknown commands are barriers
+            if (t_it == m_selectIds.end())
+                return false;
+
+            const uint64_t t_cache = std::distance(m_selectIds.begin(), t_it);
+            accessA.push_back(Access{RESOURCE::SELECT, t_cache, t_cache + 1, true});
+            m_selected[t_cache] = t_line;
+        }
+
+    return true;
+}
+
+ListScheduler::Access ListScheduler::getLine(const RESOURCE resA, const uint32_t lineA, const uint64_t placesA,
+                                             const bool writeA)
+{
+    if (lineA == UINT32_MAX)
+        return Access{resA, 0, UINT64_MAX, writeA};
+
+    if (placesA == 0)
+        return Access{resA, lineA, static_cast<uint64_t>(lineA) + 1, writeA};
+
+    return Access{resA, lineA * placesA, (lineA + 1) * placesA, writeA};
+}
+
+bool ListScheduler::conflicts(const std::vector<Access> &firstA, const std::vector<Access> &secondA)
+{
+    for (const auto &a : firstA)
+        {
+            for (const auto &b : secondA)
+                {
+                    if (a.resource == b.resource && (a.write || b.write) && a.begin < b.end && b.begin < a.end)
+                        return true;
+                }
+        }
+
+    return false;
+}
+
+uint64_t ListScheduler::schedule(std::vector<Instruction> &instsA, const std::size_t beginA,
+                                 const std::vector<std::vector<Access>> &accessA, LatencyModel::State &stateA) const
+{
+    const std::size_t t_num = accessA.size();
+    LatencyModel::State t_old{stateA};
+
+    for (std::size_t k = 0; k < t_num; ++k)
+        m_model.issue(t_old, instsA[beginA + k].word);
+
+    if (t_num < 2)
+        {
+            stateA = t_old;
+            return 0;
+        }
+
+    // Dependency graph
+    std::vector<std::vector<std::size_t>> t_succs(t_num);
+    std::vector<std::size_t> t_preds(t_num, 0);
+
+    for (std::size_t a = 0; a < t_num; ++a)
+        {
+            for (std::size_t b = a + 1; b < t_num; ++b)
+                {
+                    if (conflicts(accessA[a], accessA[b]))
+                        {
+                            t_succs[a].push_back(b);
+                            ++t_preds[b];
+                        }
+                }
+        }
+
+    // Priority: longest latency path to region end
+    std::vector<uint64_t> t_prio(t_num, 0);
+
+    for (std::size_t a = t_num; a-- > 0;)
+        {
+            uint64_t t_max{0};
+
+            for (auto s : t_succs[a])
+                t_max = std::max(t_max, t_prio[s]);
+
+            const auto t_id = m_isa.getMachineCode(instsA[beginA + a].word);
+            t_prio[a] = t_max + (t_id == m_start ? m_model.getFabric() : m_model.getLatency(t_id));
+        }
+
+    // List scheduling
+    LatencyModel::State t_new{stateA};
+    std::vector<std::size_t> t_ready{}, t_order{};
+    t_order.reserve(t_num);
+
+    for (std::size_t a = 0; a < t_num; ++a)
+        {
+            if (t_preds[a] == 0)
+                t_ready.push_back(a);
+        }
+
+    while (!t_ready.empty())
+        {
+            auto t_best = t_ready.begin();
+            auto t_bestStart = m_model.getStart(t_new, instsA[beginA + *t_best].word);
+
+            for (auto it = std::next(t_ready.begin()); it != t_ready.end(); ++it)
+                {
+                    const auto t_start = m_model.getStart(t_new, instsA[beginA + *it].word);
+
+                    if (t_start < t_bestStart || (t_start == t_bestStart && t_prio[*it] > t_prio[*t_best]) ||
+                        (t_start == t_bestStart && t_prio[*it] == t_prio[*t_best] && *it < *t_best))
+                        {
+                            t_best = it;
+                            t_bestStart = t_start;
+                        }
+                }
+
+            const std::size_t t_node = *t_best;
+            t_ready.erase(t_best);
+            t_order.push_back(t_node);
+            m_model.issue(t_new, instsA[beginA + t_node].word);
+
+            for (auto s : t_succs[t_node])
+                {
+                    if (--t_preds[s] == 0)
+                        t_ready.push_back(s);
+                }
+        }
+
+    // Keep new order only if it is not slower for the following code
+    const bool t_better = t_new.cycle <= t_old.cycle && t_new.fabricReady <= t_old.fabricReady &&
+                          (t_new.cycle < t_old.cycle || t_new.fabricReady < t_old.fabricReady);
+
+    if (!t_better)
+        {
+            stateA = t_old;
+            return 0;
+        }
+
+    std::vector<Instruction> t_region(instsA.begin() + beginA, instsA.begin() + beginA + t_num);
+    uint64_t t_moved{0};
+
+    for (std::size_t k = 0; k < t_num; ++k)
+        {
+            instsA[beginA + k] = t_region[t_order[k]];
+
+            if (t_order[k] != k)
+                ++t_moved;
+        }
+
+    stateA = t_new;
+
+    return t_moved;
+}
+
+} /* End namespace as */
@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "loadcoalescing.h"
+#include <algorithm>
+
+namespace as
+{
+
+LoadCoalescing::LoadCoalescing(const InstructionSet &isaA, const boost::property_tree::ptree &configA)
+    : LineCoalescing(isaA, "LOADD", "LOADDA", configA.get<uint32_t>("VCGRA_Property.Num_Dic_Places", 0),
+                     configA.get<uint64_t>("VCGRA_Property.Dic_Place_Stride", 1),
+                     configA.get<uint64_t>("VCGRA_Property.Available_Memory", 0), true)
+{
+    for (const auto &name : {"START", "WAIT_READY", "FINISH", "STORED", "STOREDA"})
+        {
+            auto t_id = isaA.getMachineId(name);
+
+            if (t_id != UINT32_MAX)
+                m_barrierIds.push_back(t_id);
+        }
+
+    return;
+}
+
+std::string LoadCoalescing::getName(void) const
+{
+    return "load-coalescing";
+}
+
+bool LoadCoalescing::isBarrier(const Instruction &instA, const uint32_t lineA, const uint64_t) const
+{
+    const auto t_id = m_isa.getMachineCode(instA.word);
+
+    if (t_id == m_lineId)
+        return m_isa.getLine(instA.word) == lineA;
+
+    return std::find(m_barrierIds.cbegin(), m_barrierIds.cend(), t_id) != m_barrierIds.cend();
+}
+
+} /* End namespace as */
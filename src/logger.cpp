@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "logger.h"
+#include "myException.h"
+#include <array>
+
+namespace
+{
+
+const std::array<const char *, 5> c_levelNames{"error", "warn", "info", "debug", "trace"};
+//!< @brief Names of log levels in order of enumeration LEVEL.
+
+} // end of anonymous namespace
+
+namespace as
+{
+
+Logger::Logger(std::ostream &osA, const LEVEL levelA) : m_os(osA), m_level{levelA}
+{
+    return;
+}
+
+Logger::LEVEL Logger::getLevel(void) const
+{
+    return m_level;
+}
+
+std::ostream &Logger::stream(void)
+{
+    return m_os;
+}
+
+bool Logger::isLevel(const std::string &nameA)
+{
+    for (const auto name : c_levelNames)
+        if (nameA == name)
+            return true;
+
+    return false;
+}
+
+Logger::LEVEL Logger::toLevel(const std::string &nameA)
+{
+    for (std::size_t i = 0; i < c_levelNames.size(); ++i)
+        if (nameA == c_levelNames[i])
+            return static_cast<LEVEL>(i);
+
+    throw AssemblerException("Unknown log level \"" + nameA + "\".", 1016);
+}
+
+} /* End namespace as */
@@ -17,6 +17,7 @@
 
 #include "loop.h"
 #include "iarithmetic.h"
+#include "instrumentation.h"
 #include "myException.h"
 #include "nooperand.h"
 #include "oneoperand.h"
@@ -24,6 +25,7 @@
 #include "parseobjectvariable.h"
 #include "resetvariable.h"
 #include "threeoperand.h"
+#include "tracer.h"
 #include "twooperand.h"
 #include <utility>
 
@@ -58,7 +60,7 @@ int32_t getValue(const as::ParseObjBase *objA)
 namespace as
 {
 
-Loop::Loop(Level *const parentLvlA, const uint32_t fileLineA, ParseObjBase *startValueA, ParseObjBase *endValueA,
+Loop::Loop(Level *const parentLvlA, const uint64_t fileLineA, ParseObjBase *startValueA, ParseObjBase *endValueA,
            ParseObjBase *stepwidthA, const std::string readCmdA)
     : Level{parentLvlA}, m_readCommandLine{readCmdA}, m_stepWidth{stepwidthA}, m_fileLine{fileLineA}
 {
@@ -95,13 +97,17 @@ Loop::Loop(Loop &&rhsA) : Level{std::move(rhsA)}
     m_endValue = rhsA.m_endValue;
     rhsA.m_endValue = nullptr;
     m_fileLine = rhsA.m_fileLine;
-    rhsA.m_fileLine = UINT32_MAX;
+    rhsA.m_fileLine = UINT64_MAX;
     m_readCommandLine = rhsA.m_readCommandLine;
     rhsA.m_readCommandLine.clear();
     m_startValue = rhsA.m_startValue;
     rhsA.m_startValue = nullptr;
     m_stepWidth = rhsA.m_stepWidth;
     rhsA.m_stepWidth = nullptr;
+    m_entries = rhsA.m_entries;
+    rhsA.m_entries = 0;
+    m_iterations = rhsA.m_iterations;
+    rhsA.m_iterations = 0;
 
     return;
 }
@@ -115,13 +121,17 @@ Loop &Loop::operator=(Loop &&rhsA)
     m_endValue = rhsA.m_endValue;
     rhsA.m_endValue = nullptr;
     m_fileLine = rhsA.m_fileLine;
-    rhsA.m_fileLine = UINT32_MAX;
+    rhsA.m_fileLine = UINT64_MAX;
     m_readCommandLine = rhsA.m_readCommandLine;
     rhsA.m_readCommandLine.clear();
     m_startValue = rhsA.m_startValue;
     rhsA.m_startValue = nullptr;
     m_stepWidth = rhsA.m_stepWidth;
     rhsA.m_stepWidth = nullptr;
+    m_entries = rhsA.m_entries;
+    rhsA.m_entries = 0;
+    m_iterations = rhsA.m_iterations;
+    rhsA.m_iterations = 0;
 
     return *this;
 }
@@ -178,13 +188,21 @@ bool Loop::updateLoopIndex(void)
         }
 }
 
-std::ostream &Loop::assemble(const boost::property_tree::ptree &ptreeA, std::ostream &osA)
+InstructionStream &Loop::assemble(const boost::property_tree::ptree &ptreeA, InstructionStream &streamA)
 {
 
     uint64_t lvlId{0};
+    CGRA_TRACE_SPAN("Loop::assemble", "loop");
+    CGRA_TRACE_ARG("line", getFileLine());
+    CGRA_TRACE_DECL(const uint64_t t_firstIteration{m_iterations});
+
+    ++m_entries;
 
     do
         {
+            ++m_iterations;
+            Instrumentation::count(Instrumentation::COUNTER::LOOP_ITERATIONS);
+
             for (auto po : this->getParseObjList())
                 {
                     switch (po->getCommandClass())
@@ -193,27 +211,19 @@ std::ostream &Loop::assemble(const boost::property_tree::ptree &ptreeA, std::ost
                             static_cast<as::IArithmetic *>(po)->processOperation();
                             break;
                         case as::COMMANDCLASS::NOOPERAND:
-                            osA << static_cast<as::NoOperand *>(po)->assemble(ptreeA);
-                            osA << ",";
-                            osA << " //" << po->getReadCmdLine() << std::endl;
+                            streamA.append(static_cast<as::NoOperand *>(po)->encode(ptreeA), po, this);
                             break;
                         case as::COMMANDCLASS::ONEOPERAND:
-                            osA << static_cast<as::OneOperand *>(po)->assemble(ptreeA);
-                            osA << ",";
-                            osA << " //" << po->getReadCmdLine() << std::endl;
+                            streamA.append(static_cast<as::OneOperand *>(po)->encode(ptreeA), po, this);
                             break;
                         case as::COMMANDCLASS::TWOOPERAND:
-                            osA << static_cast<as::TwoOperand *>(po)->assemble(ptreeA);
-                            osA << ",";
-                            osA << " //" << po->getReadCmdLine() << std::endl;
+                            streamA.append(static_cast<as::TwoOperand *>(po)->encode(ptreeA), po, this);
                             break;
                         case as::COMMANDCLASS::THREEOPERAND:
-                            osA << static_cast<as::ThreeOperand *>(po)->assemble(ptreeA);
-                            osA << ",";
-                            osA << " //" << po->getReadCmdLine() << std::endl;
+                            streamA.append(static_cast<as::ThreeOperand *>(po)->encode(ptreeA), po, this);
                             break;
                         case as::COMMANDCLASS::LOOP:
-                            static_cast<Loop *>(this->at(lvlId++))->assemble(ptreeA, osA);
+                            static_cast<Loop *>(this->at(lvlId++))->assemble(ptreeA, streamA);
                             break;
                         case as::COMMANDCLASS::RESETVAR:
                             static_cast<ResetVariable *>(po)->resetVariable();
@@ -230,8 +240,9 @@ std::ostream &Loop::assemble(const boost::property_tree::ptree &ptreeA, std::ost
     while (updateLoopIndex());
 
     m_currentValue = getValue(m_startValue);
+    CGRA_TRACE_ARG("iterations", m_iterations - t_firstIteration);
 
-    return osA;
+    return streamA;
 }
 
 } /* End namespace as */
@@ -15,15 +15,60 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "assembler.h"
+#include "batch.h"
+#include "instrumentation.h"
+#include "logger.h"
 #include "myException.h"
+#include "server.h"
+#include "tracer.h"
 #include <boost/program_options.hpp>
 #include <boost/property_tree/ptree.hpp>
 #include <boost/property_tree/xml_parser.hpp>
 #include <cstdlib>
+#include <fstream>
 #include <iostream>
 
-// String variable to create error message in exception.
-std::string as::AssemblerException::m_os;
+namespace
+{
+
+/**
+ * \brief Check that a path is a non-empty assembler file and print the reason otherwise.
+ *
+ * \param[in] fileA Path to assembler file.
+ * \return True if the file can be assembled.
+ */
+bool isAssemblerFile(const boost::filesystem::path &fileA)
+{
+    namespace fs = boost::filesystem;
+
+    if (!fs::exists(fileA))
+        {
+            std::cout << "Assembler file is missing" << std::endl;
+            return false;
+        }
+
+    if (!fs::is_regular_file(fileA))
+        {
+            std::cout << "Path " << fileA.string() << " is not a regular file." << std::endl;
+            return false;
+        }
+
+    if (fileA.extension() != ".asm")
+        {
+            std::cout << "File " << fileA.filename() << " has wrong file extension." << std::endl;
+            return false;
+        }
+
+    if (fs::is_empty(fileA))
+        {
+            std::cout << "File " << fileA.filename() << " is empty." << std::endl;
+            return false;
+        }
+
+    return true;
+}
+
+} // end of anonymous namespace
 
 /**
  * \brief ...
@@ -45,19 +90,51 @@ int main(int argc, char **argv)
 
     /* Define command line options for cmd-tool.
        help: Shows cmd-tool options
-       file: Path to assembler file which shall be processed.
+       file: Path to assembler file which shall be processed (several files with batch, also positional).
+       batch: Assemble all files and the files of manifest on a thread pool.
+       manifest: File with one assembler file per line for batch.
+       jobs: Number of threads of batch (0 = number of hardware threads).
+       serve: Answer assemble requests on a Unix domain socket until shutdown (config is the default).
        config: Program configuration file search path. (default=./config.cfg)
+       format: Output format, overrides "General.Format" of configuration file.
+       shard-size: Words per chunk for sharded output, overrides "General.ShardSize".
+       no-comments: Omit assembler source line comments in output, overrides "General.Comments".
+       optimize: Optimization level (-O = -O1), overrides "General.Optimize".
+       profile: Report estimated cycles per loop, overrides "General.Profile".
+       memory-profile: Report memory traffic and data reuse, overrides "General.MemoryProfile".
+       stats: Print phase timers and counters of the assembler run to std::cerr (text or json).
+       stats-file: Write phase timers and counters to a file instead of std::cerr.
+       log-level: Most verbose log level (error, warn, info, debug, trace), overrides "General.LogLevel".
+       trace: Write spans of the assembler run to a Chrome trace event file (build option CGRA_TRACE).
      */
     po::options_description desc("Usable options");
     desc.add_options()("help,", "Show command line options and usability.")(
-        "file,", po::value<std::string>()->required(), "File path to assembler file.")(
+        "file,", po::value<std::vector<std::string>>(), "File path to assembler file (several files with --batch).")(
+        "batch,", "Assemble all files and the files of --manifest on a thread pool.")(
+        "manifest,", po::value<std::string>(), "File with one assembler file per line for --batch.")(
+        "jobs,j", po::value<unsigned>()->default_value(0), "Number of threads of --batch (0 = hardware threads).")(
+        "serve,", po::value<std::string>(), "Answer assemble requests on Unix domain socket (path).")(
         "config,", po::value<std::string>()->default_value("./config.cfg"),
-        "Assembler configuration file.")("log,", po::value<std::string>(), "Log file path.");
+        "Assembler configuration file.")("log,", po::value<std::string>(), "Log file path.")(
+        "log-level,", po::value<std::string>(), "Most verbose log level (error, warn, info, debug, trace).")(
+        "format,", po::value<std::string>(), "Output format (vector, sharded, constexpr).")(
+        "shard-size,", po::value<uint64_t>(), "Maximum number of words per chunk for output format sharded.")(
+        "no-comments,", "Omit assembler source line comments in output files.")(
+        "optimize,O", po::value<unsigned>()->implicit_value(1), "Optimization level (0 = off, 1 = peephole, 2 = pipelining, -O = 1).")(
+        "profile,", "Report estimated cycles per loop with the latencies of section Timing.")(
+        "memory-profile,", "Report memory traffic per loop, address histogram and reuse distances.")(
+        "stats,", po::value<std::string>()->implicit_value("text"),
+        "Print phase timers and counters to std::cerr (text, json).")(
+        "stats-file,", po::value<std::string>(), "Write statistics of --stats to file instead of std::cerr.")(
+        "trace,", po::value<std::string>(), "Write Chrome trace event file of assembler run (chrome://tracing, Perfetto).");
 
     /* Parse cmd-line arguments and store them in variables map.*/
     po::variables_map vm;
     //!< \brief Variable map to store command line options.
-    po::store(po::parse_command_line(argc, argv, desc), vm);
+    po::positional_options_description positional;
+    //!< \brief Assembler files without option name.
+    positional.add("file", -1);
+    po::store(po::command_line_parser(argc, argv).options(desc).positional(positional).run(), vm);
     po::notify(vm);
 
     // If help is within vm, show description.
@@ -67,6 +144,34 @@ int main(int argc, char **argv)
             return EXIT_SUCCESS;
         }
 
+    // Record phase timers and counters, if statistics are requested.
+    as::Instrumentation stats{};
+    //!< \brief Phase timers and counters of assembler run.
+    if (vm.count("stats") != 0U)
+        {
+            if (!as::Instrumentation::isFormat(vm["stats"].as<std::string>()))
+                {
+                    std::cout << "Unknown statistics format \"" << vm["stats"].as<std::string>() << "\"." << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+            as::Instrumentation::setCurrent(&stats);
+        }
+
+    // Record spans, if a trace file is requested.
+    as::Tracer tracer{};
+    //!< \brief Spans of assembler run.
+    if (vm.count("trace") != 0U)
+        {
+            if (!as::Tracer::isAvailable())
+                {
+                    std::cout << "Option --trace is not available, build with CGRA_TRACE=ON." << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+            as::Tracer::setCurrent(&tracer);
+        }
+
     if (vm.count("log") != 0U)
         {
             /* Create file system path variable for log file.*/
@@ -85,33 +190,38 @@ int main(int argc, char **argv)
                 }
         }
 
-    /* Create file system path variable to validate assembler input file.*/
-    fs::path filePtr{vm["file"].as<std::string>().c_str()};
-    //!< \brief Handle path to assembler file.
-    if (!fs::exists(filePtr))
-        {
-            std::cout << "Assembler file is missing" << std::endl;
-            return EXIT_FAILURE;
-        }
+    const bool batch = vm.count("batch") != 0U;
+    //!< \brief Assemble several files on a thread pool.
+    const bool serve = vm.count("serve") != 0U;
+    //!< \brief Answer assemble requests of clients.
+    const std::vector<std::string> files =
+        vm.count("file") != 0U ? vm["file"].as<std::vector<std::string>>() : std::vector<std::string>{};
+    //!< \brief Assembler files from command line.
 
-    if (!fs::is_regular_file(filePtr))
+    if (batch && vm.count("log") != 0U)
         {
-            std::cout << "Path " << filePtr.string() << " is not a regular file." << std::endl;
+            std::cout << "Option --log is not available with --batch, every file gets its own log file." << std::endl;
             return EXIT_FAILURE;
         }
 
-    if (filePtr.extension() != ".asm")
+    if (serve && (batch || !files.empty()))
         {
-            std::cout << "File " << filePtr.filename() << " has wrong file extension." << std::endl;
+            std::cout << "Option --serve takes assembler files from requests only." << std::endl;
             return EXIT_FAILURE;
         }
 
-    if (fs::is_empty(filePtr))
+    if (!batch && !serve && files.size() != 1)
         {
-            std::cout << "File " << filePtr.filename() << " is empty." << std::endl;
+            std::cout << "Exactly one assembler file is required (use --batch for several files)." << std::endl;
             return EXIT_FAILURE;
         }
 
+    /* Create file system path variable to validate assembler input file.*/
+    fs::path filePtr{batch || serve ? "" : files.front().c_str()};
+    //!< \brief Handle path to assembler file (files of batch and server are checked by their jobs).
+    if (!batch && !serve && !isAssemblerFile(filePtr))
+        return EXIT_FAILURE;
+
     /* Create file system path variable to validate configuration file.*/
     fs::path configPtr{vm["config"].as<std::string>().c_str()};
     //!< \brief Handle path to configuration file.
@@ -144,6 +254,7 @@ int main(int argc, char **argv)
     if (fb.open(configPtr.c_str(), std::ios::in) != nullptr)
         {
             std::istream is(&fb);
+            as::Instrumentation::Timer configTimer{"config"};
             pt::read_xml(is, parsed_options);
             fb.close();
         }
@@ -153,10 +264,62 @@ int main(int argc, char **argv)
             return EXIT_FAILURE;
         }
 
+    // Command line options overwrite options of configuration file.
+    if (vm.count("format") != 0U)
+        parsed_options.put("General.Format", vm["format"].as<std::string>());
+
+    if (vm.count("shard-size") != 0U)
+        parsed_options.put("General.ShardSize", vm["shard-size"].as<uint64_t>());
+
+    if (vm.count("no-comments") != 0U)
+        parsed_options.put("General.Comments", false);
+
+    if (vm.count("optimize") != 0U)
+        parsed_options.put("General.Optimize", vm["optimize"].as<unsigned>());
+
+    if (vm.count("profile") != 0U)
+        parsed_options.put("General.Profile", true);
+
+    if (vm.count("memory-profile") != 0U)
+        parsed_options.put("General.MemoryProfile", true);
+
+    if (vm.count("log-level") != 0U)
+        {
+            if (!as::Logger::isLevel(vm["log-level"].as<std::string>()))
+                {
+                    std::cout << "Unknown log level \"" << vm["log-level"].as<std::string>() << "\"." << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+            parsed_options.put("General.LogLevel", vm["log-level"].as<std::string>());
+        }
+
+    uint64_t failed{0};
+    //!< \brief Number of failed files of batch.
     try
         {
+            // Answer requests of clients
+            if (serve)
+                {
+                    as::Server server{vm["serve"].as<std::string>(), parsed_options};
+                    server.run(std::cout);
+                }
+            // Run assembler on all files of batch
+            else if (batch)
+                {
+                    as::Instrumentation::Timer batchTimer{"batch"};
+                    as::Batch jobs{parsed_options, vm["jobs"].as<unsigned>()};
+
+                    for (const auto &file : files)
+                        jobs.add(file);
+
+                    if (vm.count("manifest") != 0U)
+                        jobs.readManifest(vm["manifest"].as<std::string>());
+
+                    failed = jobs.run(std::cout);
+                }
             // Run assembler with log file
-            if (vm.count("log") != 0U)
+            else if (vm.count("log") != 0U)
                 {
 
                     /* Create file system path variable for log file.*/
@@ -192,5 +355,37 @@ int main(int argc, char **argv)
             return EXIT_FAILURE;
         }
 
-    return EXIT_SUCCESS;
+    // Statistics are separated from the log on std::cout (e.g. for JSON parsers)
+    if (vm.count("stats") != 0U)
+        {
+            if (vm.count("stats-file") != 0U)
+                {
+                    std::ofstream statsFile{vm["stats-file"].as<std::string>()};
+
+                    if (!statsFile)
+                        {
+                            std::cout << "Error while opening statistics file." << std::endl;
+                            return EXIT_FAILURE;
+                        }
+
+                    stats.report(statsFile, vm["stats"].as<std::string>());
+                }
+            else
+                stats.report(std::cerr, vm["stats"].as<std::string>());
+        }
+
+    if (vm.count("trace") != 0U)
+        {
+            std::ofstream traceFile{vm["trace"].as<std::string>()};
+
+            if (!traceFile)
+                {
+                    std::cout << "Error while opening trace file." << std::endl;
+                    return EXIT_FAILURE;
+                }
+
+            tracer.write(traceFile);
+        }
+
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
 }
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "memoryassembler.h"
+#include "assembler.h"
+#include "myException.h"
+#include <boost/property_tree/xml_parser.hpp>
+#include <sstream>
+
+namespace as
+{
+
+MemoryAssembler::MemoryAssembler(const boost::property_tree::ptree &configA) : m_config{configA}
+{
+    return;
+}
+
+boost::property_tree::ptree MemoryAssembler::readConfig(const std::string &xmlA)
+{
+    boost::property_tree::ptree t_config{};
+    std::istringstream t_is{xmlA};
+
+    try
+        {
+            boost::property_tree::read_xml(t_is, t_config);
+        }
+    catch (const boost::property_tree::ptree_error &e)
+        {
+            throw AssemblerException(std::string{"Error while loading configuration: "} + e.what(), 1019);
+        }
+
+    return t_config;
+}
+
+MemoryAssembler::Program MemoryAssembler::assemble(const std::string &sourceA) const
+{
+    std::ostream t_log{nullptr};
+
+    return assemble(sourceA, t_log);
+}
+
+MemoryAssembler::Program MemoryAssembler::assemble(const std::string &sourceA, std::ostream &logA) const
+{
+    Program t_program{};
+    std::istringstream t_is{sourceA};
+    Assembler t_as{m_config, logA};
+
+    t_as.parse(t_is);
+
+    const InstructionStream &t_stream = t_as.compile();
+
+    t_program.words.reserve(t_stream.size());
+    t_program.lines.reserve(t_stream.size());
+
+    for (auto it = t_stream.cbegin(); it != t_stream.cend(); ++it)
+        {
+            t_program.words.push_back(it->word);
+            t_program.lines.push_back(it->source->getFileLineNumber());
+        }
+
+    return t_program;
+}
+
+boost::property_tree::ptree &MemoryAssembler::getConfig(void)
+{
+    return m_config;
+}
+
+} /* End namespace as */
@@ -0,0 +1,356 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "memoryprofiler.h"
+#include "loop.h"
+#include <algorithm>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+namespace
+{
+
+const std::size_t c_noParent{std::numeric_limits<std::size_t>::max()};
+
+/**
+ * @brief Fenwick tree to count marked positions of an access sequence.
+ */
+class PositionCounter
+{
+  public:
+    explicit PositionCounter(const uint64_t sizeA) : m_tree(sizeA + 1, 0)
+    {
+        return;
+    }
+
+    /**
+     * @brief Add deltaA to position posA.
+     */
+    void add(uint64_t posA, const int64_t deltaA)
+    {
+        for (++posA; posA < m_tree.size(); posA += posA & (~posA + 1))
+            m_tree[posA] += deltaA;
+
+        return;
+    }
+
+    /**
+     * @brief Sum of positions [0, posA).
+     */
+    int64_t sum(uint64_t posA) const
+    {
+        int64_t t_sum{0};
+
+        for (; posA > 0; posA -= posA & (~posA + 1))
+            t_sum += m_tree[posA];
+
+        return t_sum;
+    }
+
+  private:
+    std::vector<int64_t> m_tree;
+};
+
+/**
+ * @brief Get distance class of a reuse distance (0, 1, 2-3, 4-7, ...).
+ */
+uint32_t getDistanceClass(uint64_t distanceA)
+{
+    uint32_t t_class{0};
+
+    for (; distanceA > 0; distanceA >>= 1)
+        ++t_class;
+
+    return t_class;
+}
+
+/**
+ * @brief Format percentage of partA in totalA.
+ */
+std::string getPercentage(const uint64_t partA, const uint64_t totalA)
+{
+    std::ostringstream t_os{};
+    t_os << std::fixed << std::setprecision(1) << (totalA != 0 ? 100.0 * partA / totalA : 0.0) << "%";
+
+    return t_os.str();
+}
+
+} // end of anonymous namespace
+
+namespace as
+{
+
+MemoryProfiler::MemoryProfiler(const InstructionSet &isaA, const boost::property_tree::ptree &configA)
+    : m_loadd{isaA.getMachineId("LOADD")}, m_loadda{isaA.getMachineId("LOADDA")},
+      m_stored{isaA.getMachineId("STORED")}, m_storeda{isaA.getMachineId("STOREDA")},
+      m_dicPlaces{configA.get<uint64_t>("VCGRA_Property.Num_Dic_Places", 0)},
+      m_docPlaces{configA.get<uint64_t>("VCGRA_Property.Num_Doc_Places", 0)},
+      m_dicStride{std::max<uint64_t>(configA.get<uint64_t>("VCGRA_Property.Dic_Place_Stride", 1), 1)},
+      m_docStride{std::max<uint64_t>(configA.get<uint64_t>("VCGRA_Property.Doc_Place_Stride", 1), 1)},
+      m_bucket{std::max<uint64_t>(configA.get<uint64_t>("General.HistogramBucket", 256), 1)}, m_loads{0},
+      m_reloads{0}, m_redundant{0}, m_firstAccesses{0}, m_isa{isaA}
+{
+    return;
+}
+
+bool MemoryProfiler::getAccesses(const uint64_t wordA, std::vector<Access> &accessA) const
+{
+    const uint32_t t_id = m_isa.getMachineCode(wordA);
+    const uint64_t t_addr = m_isa.getAddress(wordA);
+
+    accessA.clear();
+
+    if (t_id == m_loadd)
+        accessA.push_back(Access{t_addr, m_dicStride, false});
+    else if (t_id == m_loadda)
+        for (uint64_t p = 0; p < m_dicPlaces; ++p)
+            accessA.push_back(Access{t_addr + p * m_dicStride, m_dicStride, false});
+    else if (t_id == m_stored)
+        accessA.push_back(Access{t_addr, m_docStride, true});
+    else if (t_id == m_storeda)
+        for (uint64_t p = 0; p < m_docPlaces; ++p)
+            accessA.push_back(Access{t_addr + p * m_docStride, m_docStride, true});
+    else
+        return false;
+
+    return true;
+}
+
+void MemoryProfiler::add(Traffic &sumA, const Traffic &trafficA)
+{
+    sumA.loaded += trafficA.loaded;
+    sumA.stored += trafficA.stored;
+    sumA.transfers += trafficA.transfers;
+
+    return;
+}
+
+std::size_t MemoryProfiler::getLoop(const Loop *loopA)
+{
+    auto t_entry = m_loopIndex.find(loopA);
+
+    if (t_entry != m_loopIndex.end())
+        return t_entry->second;
+
+    std::size_t t_parent{c_noParent};
+    uint64_t t_depth{0};
+
+    // Enclosing loops are added first, the top level has no parent
+    if (loopA != nullptr)
+        {
+            if (loopA->leave()->hasParent())
+                t_parent = getLoop(static_cast<const Loop *>(loopA->leave()));
+
+            t_depth = t_parent != c_noParent ? m_loops[t_parent].depth + 1 : 1;
+        }
+
+    m_loops.push_back(LoopTraffic{loopA, t_parent, t_depth, Traffic{0, 0, 0}, Traffic{0, 0, 0}});
+    m_loopIndex.emplace(loopA, m_loops.size() - 1);
+
+    return m_loops.size() - 1;
+}
+
+void MemoryProfiler::run(const InstructionStream &streamA)
+{
+    m_loops.clear();
+    m_loopIndex.clear();
+    m_histogram.clear();
+    m_addresses.clear();
+    m_distances.clear();
+    m_loads = m_reloads = m_redundant = m_firstAccesses = 0;
+
+    std::vector<Access> t_accesses{};
+    uint64_t t_total{0};
+
+    // Number of accesses to size the position counter
+    for (auto it = streamA.cbegin(); it != streamA.cend(); ++it)
+        if (getAccesses(it->word, t_accesses))
+            t_total += t_accesses.size();
+
+    // Every address is marked at the position of its last access. The reuse distance of an access
+    // is the number of marks between the last access of its address and the current position.
+    PositionCounter t_marks{t_total};
+    uint64_t t_pos{0};
+    const Loop *t_lastLoop{nullptr};
+    std::size_t t_loop{getLoop(nullptr)};
+
+    for (auto it = streamA.cbegin(); it != streamA.cend(); ++it)
+        {
+            // Every word adds its loop, thus loops without own transfers are reported too
+            if (it->loop != t_lastLoop)
+                {
+                    t_lastLoop = it->loop;
+                    t_loop = getLoop(t_lastLoop);
+                }
+
+            if (!getAccesses(it->word, t_accesses))
+                continue;
+
+            Traffic t_traffic{0, 0, 1};
+
+            for (const auto &access : t_accesses)
+                {
+                    auto &t_bucket = m_histogram[access.address / m_bucket];
+                    auto t_entry = m_addresses.emplace(access.address, Address{0, 0, 0, 0, false, false});
+                    Address &t_info = t_entry.first->second;
+
+                    if (access.store)
+                        {
+                            t_traffic.stored += access.bytes;
+                            ++t_bucket.second;
+                        }
+                    else
+                        {
+                            t_traffic.loaded += access.bytes;
+                            ++t_bucket.first;
+                            ++t_info.loads;
+                            ++m_loads;
+                        }
+
+                    if (t_entry.second)
+                        ++m_firstAccesses;
+                    else
+                        {
+                            const uint64_t t_distance =
+                                static_cast<uint64_t>(t_marks.sum(t_pos) - t_marks.sum(t_info.lastAccess + 1));
+                            const uint32_t t_class = getDistanceClass(t_distance);
+
+                            if (m_distances.size() <= t_class)
+                                m_distances.resize(t_class + 1, 0);
+
+                            ++m_distances[t_class];
+                            t_marks.add(t_info.lastAccess, -1);
+
+                            if (!access.store && t_info.loaded)
+                                {
+                                    ++t_info.reloads;
+                                    t_info.distanceSum += t_distance;
+                                    ++m_reloads;
+
+                                    if (t_info.clean)
+                                        ++m_redundant;
+                                }
+                        }
+
+                    t_marks.add(t_pos, 1);
+                    t_info.lastAccess = t_pos++;
+
+                    if (access.store)
+                        t_info.clean = false;
+                    else
+                        t_info.loaded = t_info.clean = true;
+                }
+
+            add(m_loops[t_loop].self, t_traffic);
+
+            for (std::size_t l = t_loop; l != c_noParent; l = m_loops[l].parent)
+                add(m_loops[l].total, t_traffic);
+        }
+
+    return;
+}
+
+void MemoryProfiler::report(std::ostream &osA) const
+{
+    Traffic t_sum{0, 0, 0};
+
+    for (const auto &loop : m_loops)
+        add(t_sum, loop.self);
+
+    osA << "Memory traffic: " << t_sum.loaded << " bytes loaded, " << t_sum.stored << " bytes stored, "
+        << t_sum.transfers << " transfers" << std::endl;
+
+    osA << "Traffic per loop (including nested loops):" << std::endl;
+
+    for (const auto &loop : m_loops)
+        {
+            // Traffic of top level is the sum above, report only transfers outside of loops
+            if (loop.loop == nullptr)
+                {
+                    if (loop.self.transfers != 0)
+                        osA << "    Outside of loops: " << loop.self.loaded << " bytes loaded, " << loop.self.stored
+                            << " bytes stored, " << loop.self.transfers << " transfers" << std::endl;
+
+                    continue;
+                }
+
+            osA << "    " << loop.loop->getReadCommandLine() << " (line " << loop.loop->getFileLine() << ", depth "
+                << loop.depth << "): " << loop.total.loaded << " bytes loaded, " << loop.total.stored
+                << " bytes stored, " << loop.total.transfers << " transfers (self: " << loop.self.loaded
+                << " bytes loaded, " << loop.self.stored << " bytes stored, " << loop.self.transfers << " transfers)"
+                << std::endl;
+        }
+
+    osA << "Accesses per address range of " << m_bucket << " bytes:" << std::endl;
+
+    for (const auto &bucket : m_histogram)
+        osA << "    0x" << std::hex << std::uppercase << std::setw(6) << std::setfill('0') << bucket.first * m_bucket
+            << "-0x" << std::setw(6) << (bucket.first + 1) * m_bucket - 1 << std::dec << std::setfill(' ') << ": "
+            << bucket.second.first << " loads, " << bucket.second.second << " stores" << std::endl;
+
+    osA << "Reuse distances (distinct addresses between accesses of an address):" << std::endl;
+    osA << "    first access: " << m_firstAccesses << std::endl;
+
+    for (uint32_t c = 0; c < m_distances.size(); ++c)
+        {
+            if (m_distances[c] == 0)
+                continue;
+
+            osA << "    ";
+
+            if (c < 2)
+                osA << c;
+            else
+                osA << (uint64_t{1} << (c - 1)) << "-" << (uint64_t{1} << c) - 1;
+
+            osA << ": " << m_distances[c] << std::endl;
+        }
+
+    osA << "Reloads of loaded data: " << m_reloads << " of " << m_loads << " loads ("
+        << getPercentage(m_reloads, m_loads) << "), without store in between: " << m_redundant << " ("
+        << getPercentage(m_redundant, m_loads) << ")" << std::endl;
+
+    // Addresses with the most reloads
+    std::vector<std::pair<uint64_t, const Address *>> t_ranked{};
+
+    for (const auto &address : m_addresses)
+        if (address.second.reloads != 0)
+            t_ranked.emplace_back(address.first, &address.second);
+
+    std::sort(t_ranked.begin(), t_ranked.end(),
+              [](const std::pair<uint64_t, const Address *> &lhsA, const std::pair<uint64_t, const Address *> &rhsA)
+              {
+                  return lhsA.second->reloads != rhsA.second->reloads ? lhsA.second->reloads > rhsA.second->reloads
+                                                                      : lhsA.first < rhsA.first;
+              });
+
+    if (t_ranked.size() > 10)
+        t_ranked.resize(10);
+
+    if (!t_ranked.empty())
+        osA << "Most reloaded addresses:" << std::endl;
+
+    for (const auto &address : t_ranked)
+        osA << "    0x" << std::hex << std::uppercase << std::setw(6) << std::setfill('0') << address.first << std::dec
+            << std::setfill(' ') << ": " << address.second->reloads << " reloads of " << address.second->loads
+            << " loads, mean reuse distance " << address.second->distanceSum / address.second->reloads << std::endl;
+
+    return;
+}
+
+} /* End namespace as */
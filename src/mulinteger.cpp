@@ -25,7 +25,7 @@
 namespace as
 {
 
-MulInteger::MulInteger(Level *lvlA, const std::string &cmdLineA, const uint32_t &lineNumberA, ParseObjBase *firstA,
+MulInteger::MulInteger(Level *lvlA, const std::string &cmdLineA, const uint64_t &lineNumberA, ParseObjBase *firstA,
                        ParseObjBase *secondA)
     : IArithmetic{lvlA, cmdLineA, lineNumberA, firstA, secondA}
 {
@@ -19,7 +19,7 @@
 #include <sstream>
 #include <utility>
 
-as::NoOperand::NoOperand(as::Level *const lvlA, const std::string &cmdLineA, const uint32_t lineNumberA,
+as::NoOperand::NoOperand(as::Level *const lvlA, const std::string &cmdLineA, const uint64_t lineNumberA,
                          const uint32_t machineIdA)
     : as::ParseObjBase{lvlA, as::COMMANDCLASS::NOOPERAND, cmdLineA, lineNumberA}, m_machineCodeID{machineIdA}
 {
@@ -85,13 +85,19 @@ uint32_t as::NoOperand::setMachineCodeId(const uint32_t machineIdA)
 std::string as::NoOperand::assemble(const boost::property_tree::ptree &ptreeA)
 {
     // Temporary variables
-    std::ostringstream t_os{""};
+    std::ostringstream t_os{""}; // Formated machine code command
+    auto t_word = this->encode(ptreeA);
 
-    t_os << "\"" << m_fmtStr % 0u % this->getMachineCodeId() << "\"";
+    t_os << "\"" << m_fmtStr % (t_word >> 16) % (t_word & 0xFFFF) << "\"";
 
     return t_os.str();
 }
 
+uint64_t as::NoOperand::encode(const boost::property_tree::ptree &)
+{
+    return this->getMachineCodeId();
+}
+
 std::ostream &operator<<(std::ostream &osA, const as::NoOperand &opA)
 {
     osA << static_cast<const as::ParseObjBase &>(opA) << "; ";
@@ -23,7 +23,7 @@
 #include <sstream>
 #include <utility>
 
-as::OneOperand::OneOperand(Level *const lvlA, const std::string &cmdLineA, const uint32_t lineNumberA,
+as::OneOperand::OneOperand(Level *const lvlA, const std::string &cmdLineA, const uint64_t lineNumberA,
                            ParseObjBase *const firstA, const uint32_t machineIdA)
     : as::ParseObjBase{lvlA, as::COMMANDCLASS::ONEOPERAND, cmdLineA, lineNumberA},
       m_machineCodeId{machineIdA}, m_first{firstA}
@@ -90,9 +90,19 @@ void as::OneOperand::clearMembers(void)
 }
 
 std::string as::OneOperand::assemble(const boost::property_tree::ptree &ptreeA)
+{
+    // Temporary variables
+    std::ostringstream t_os{""}; // Formated machine code command
+    auto t_word = this->encode(ptreeA);
+
+    t_os << "\"" << m_fmtStr % (t_word >> 16) % (t_word & 0xFFFF) << "\"";
+
+    return t_os.str();
+}
+
+uint64_t as::OneOperand::encode(const boost::property_tree::ptree &ptreeA)
 {
     // Tempoarary variables
-    std::ostringstream t_os{""};                                               // Formated machine code command
     auto t_OpcodeSize = ptreeA.get<uint32_t>("Assembler_Property.OpCodeSize"); // Opcode size in machine code signal
     auto t_PlaceSize = ptreeA.get<uint32_t>("Assembler_Property.PlaceSize");   // Places size in machine code signal
     uint32_t t_numOfAvailableLines{0}; // Number of available cache lines for range check of argument of command
@@ -153,9 +163,7 @@ std::string as::OneOperand::assemble(const boost::property_tree::ptree &ptreeA)
     else
         throw as::AssemblerException("Selected cache line is not available.", 8614);
 
-    t_os << "\"" << m_fmtStr % 0u % t_val << "\"";
-
-    return t_os.str();
+    return t_val;
 }
 
 std::ostream &operator<<(std::ostream &osA, const as::OneOperand &opA)
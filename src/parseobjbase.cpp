@@ -16,12 +16,13 @@
  */
 
 #include "../header/parseobjbase.h"
+#include "instrumentation.h"
 #include <stdexcept>
 
 namespace as
 {
 
-ParseObjBase::ParseObjBase(Level *levelA, COMMANDCLASS cmdA, const std::string &cmdLineA, const uint32_t lineNumberA)
+ParseObjBase::ParseObjBase(Level *levelA, COMMANDCLASS cmdA, const std::string &cmdLineA, const uint64_t lineNumberA)
     : m_class{cmdA}, m_cmdLine{cmdLineA}, m_lineNumber{lineNumberA}
 {
     if (levelA)
@@ -29,6 +30,8 @@ ParseObjBase::ParseObjBase(Level *levelA, COMMANDCLASS cmdA, const std::string &
     else
         throw std::invalid_argument{"Pointer to current level is invalid."};
 
+    Instrumentation::countObject(cmdA);
+
     return;
 }
 
@@ -87,7 +90,7 @@ std::string ParseObjBase::getReadCmdLine() const
     return m_cmdLine;
 }
 
-uint32_t ParseObjBase::getFileLineNumber() const
+uint64_t ParseObjBase::getFileLineNumber() const
 {
     return m_lineNumber;
 }
@@ -136,7 +139,7 @@ Level *const ParseObjBase::setLevel(const as::Level *newA)
     return t_lvl;
 }
 
-u_int32_t ParseObjBase::setLineNumber(const u_int32_t newA)
+uint64_t ParseObjBase::setLineNumber(const uint64_t newA)
 {
     auto t_num = m_lineNumber;
     m_lineNumber = newA;
@@ -21,7 +21,7 @@ namespace as
 {
 
 ParseObjectConst::ParseObjectConst(const std::string &nameA, int32_t valueA, Level *lvlA, const std::string &cmdLineA,
-                                   const uint32_t lineNumberA)
+                                   const uint64_t lineNumberA)
     : as::ParseObjBase{lvlA, COMMANDCLASS::CONSTANT, cmdLineA, lineNumberA}, m_value{valueA}, m_name{nameA}
 {
     return;
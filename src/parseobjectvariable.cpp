@@ -21,7 +21,7 @@ namespace as
 {
 
 ParseObjectVariable::ParseObjectVariable(const std::string &nameA, const int32_t valueA, Level *lvlA,
-                                         const std::string &cmdLineA, uint32_t lineNumberA)
+                                         const std::string &cmdLineA, uint64_t lineNumberA)
     : ParseObjBase{lvlA, COMMANDCLASS::VARIABLE, cmdLineA, lineNumberA}, m_name{nameA}, m_value{valueA}
 {
 }
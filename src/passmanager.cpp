@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "passmanager.h"
+#include "instrumentation.h"
+#include "myException.h"
+#include "tracer.h"
+#include <chrono>
+#include <iomanip>
+
+namespace as
+{
+
+PassManager::PassManager(const boost::property_tree::ptree &configA, const unsigned levelA) : m_level{levelA}
+{
+    if (m_level > 0)
+        m_isa.reset(new InstructionSet(configA));
+
+    return;
+}
+
+unsigned PassManager::getLevel(void) const
+{
+    return m_level;
+}
+
+const InstructionSet &PassManager::getInstructionSet(void) const
+{
+    if (!m_isa)
+        throw AssemblerException("No instruction set available without optimization.", 1009);
+
+    return *m_isa;
+}
+
+void PassManager::addPass(const unsigned minLevelA, ILevelPass *passA)
+{
+    std::unique_ptr<ILevelPass> t_pass{passA};
+
+    if (t_pass && minLevelA <= m_level)
+        {
+            m_levelPasses.push_back(std::move(t_pass));
+            m_levelStats.push_back(Statistics{0, 0, 0, 0.0});
+        }
+
+    return;
+}
+
+void PassManager::addPass(const unsigned minLevelA, IPass *passA)
+{
+    std::unique_ptr<IPass> t_pass{passA};
+
+    if (t_pass && minLevelA <= m_level)
+        {
+            m_streamPasses.push_back(std::move(t_pass));
+            m_streamStats.push_back(Statistics{0, 0, 0, 0.0});
+        }
+
+    return;
+}
+
+uint64_t PassManager::run(Level *const levelA)
+{
+    uint64_t t_changes{0};
+
+    for (std::size_t i = 0; i < m_levelPasses.size(); ++i)
+        {
+            CGRA_TRACE_SPAN(m_levelPasses[i]->getName(), "pass");
+            auto t_begin = std::chrono::steady_clock::now();
+            m_levelStats[i].changes = m_levelPasses[i]->run(levelA);
+            auto t_end = std::chrono::steady_clock::now();
+
+            m_levelStats[i].milliseconds = std::chrono::duration<double, std::milli>(t_end - t_begin).count();
+            Instrumentation::record("pass " + m_levelPasses[i]->getName(), m_levelStats[i].milliseconds);
+            CGRA_TRACE_ARG("changes", m_levelStats[i].changes);
+            t_changes += m_levelStats[i].changes;
+        }
+
+    return t_changes;
+}
+
+uint64_t PassManager::run(InstructionStream &streamA)
+{
+    uint64_t t_changes{0};
+
+    for (std::size_t i = 0; i < m_streamPasses.size(); ++i)
+        {
+            m_streamStats[i].wordsBefore = streamA.size();
+
+            CGRA_TRACE_SPAN(m_streamPasses[i]->getName(), "pass");
+            auto t_begin = std::chrono::steady_clock::now();
+            m_streamStats[i].changes = m_streamPasses[i]->run(streamA);
+            auto t_end = std::chrono::steady_clock::now();
+
+            m_streamStats[i].wordsAfter = streamA.size();
+            m_streamStats[i].milliseconds = std::chrono::duration<double, std::milli>(t_end - t_begin).count();
+            Instrumentation::record("pass " + m_streamPasses[i]->getName(), m_streamStats[i].milliseconds);
+            CGRA_TRACE_ARG("changes", m_streamStats[i].changes);
+            t_changes += m_streamStats[i].changes;
+        }
+
+    return t_changes;
+}
+
+void PassManager::report(std::ostream &osA) const
+{
+    osA << "Optimization level " << m_level << std::endl;
+    osA << std::fixed << std::setprecision(3);
+
+    for (std::size_t i = 0; i < m_levelPasses.size(); ++i)
+        {
+            osA << "Pass " << m_levelPasses[i]->getName() << ": " << m_levelStats[i].changes << " changes, "
+                << m_levelStats[i].milliseconds << " ms" << std::endl;
+            m_levelPasses[i]->report(osA);
+        }
+
+    for (std::size_t i = 0; i < m_streamPasses.size(); ++i)
+        {
+            osA << "Pass " << m_streamPasses[i]->getName() << ": " << m_streamStats[i].changes << " changes, "
+                << m_streamStats[i].wordsBefore << " -> " << m_streamStats[i].wordsAfter << " words, "
+                << m_streamStats[i].milliseconds << " ms" << std::endl;
+            m_streamPasses[i]->report(osA);
+        }
+
+    osA << std::defaultfloat << std::flush;
+
+    return;
+}
+
+} /* End namespace as */
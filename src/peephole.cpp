@@ -0,0 +1,296 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "peephole.h"
+#include "myException.h"
+#include <boost/tokenizer.hpp>
+#include <cctype>
+#include <map>
+#include <stdexcept>
+
+namespace as
+{
+
+Peephole::Peephole(const InstructionSet &isaA, const boost::property_tree::ptree &configA, const unsigned levelA)
+    : m_isa{isaA}
+{
+    const auto t_rules = configA.get_child_optional("Optimizer.Peephole");
+
+    if (!t_rules)
+        return;
+
+    uint32_t t_index{0};
+
+    for (const auto &rule : *t_rules)
+        {
+            if (rule.first != "Rule")
+                continue;
+
+            ++t_index;
+
+            try
+                {
+                    if (rule.second.get<unsigned>("Level", 1) > levelA)
+                        continue;
+
+                    Rule t_rule{rule.second.get<std::string>("Name"), {}, {}, 0, 0};
+                    parseMatch(t_rule, rule.second.get<std::string>("Match"));
+                    parseReplace(t_rule, rule.second.get<std::string>("Replace", ""));
+
+                    m_rules.push_back(std::move(t_rule));
+                }
+            catch (const boost::property_tree::ptree_error &e)
+                {
+                    throw AssemblerException("Peephole rule " + std::to_string(t_index) + ": " + e.what(), 1008);
+                }
+        }
+
+    return;
+}
+
+std::string Peephole::getName(void) const
+{
+    return "peephole";
+}
+
+uint64_t Peephole::run(InstructionStream &streamA)
+{
+    uint64_t t_changes{0};
+
+    for (auto &rule : m_rules)
+        rule.applied = 0;
+
+    if (m_rules.empty())
+        return t_changes;
+
+    std::vector<Instruction> &t_insts = streamA.getInstructions();
+    std::vector<Instruction> t_out{};
+    t_out.reserve(t_insts.size());
+
+    // Every window is checked when its last instruction is appended. After a rewrite the
+    // windows ending at the new tail are checked again, thus rewriting reaches a fixpoint.
+    for (const auto &inst : t_insts)
+        {
+            t_out.push_back(inst);
+
+            bool t_rewritten{true};
+
+            while (t_rewritten)
+                {
+                    t_rewritten = false;
+
+                    for (auto &rule : m_rules)
+                        {
+                            if (!matches(rule, t_out, t_out.size()))
+                                continue;
+
+                            const std::size_t t_begin = t_out.size() - rule.match.size();
+                            std::vector<Instruction> t_kept{};
+
+                            for (auto k : rule.keep)
+                                t_kept.push_back(t_out[t_begin + k]);
+
+                            t_out.resize(t_begin);
+                            t_out.insert(t_out.end(), t_kept.begin(), t_kept.end());
+
+                            ++rule.applied;
+                            ++t_changes;
+                            t_rewritten = true;
+                            break;
+                        }
+                }
+        }
+
+    t_insts.swap(t_out);
+
+    return t_changes;
+}
+
+void Peephole::report(std::ostream &osA) const
+{
+    for (const auto &rule : m_rules)
+        osA << "    Rule " << rule.name << ": " << rule.applied << " applications" << std::endl;
+
+    return;
+}
+
+void Peephole::parseMatch(Rule &ruleA, const std::string &matchA) const
+{
+    typedef boost::tokenizer<boost::char_separator<char>> tokenizer;
+
+    std::map<std::string, uint64_t> t_bindings{};
+
+    for (const auto &command : tokenizer(matchA, boost::char_separator<char>(";")))
+        {
+            tokenizer t_tokens(command, boost::char_separator<char>(" \t\n\r"));
+            auto t_tok = t_tokens.begin();
+
+            // Ignore empty commands, e.g. after a trailing separator
+            if (t_tok == t_tokens.end())
+                continue;
+
+            Pattern t_pattern{m_isa.getMachineId(*t_tok), {}};
+
+            if (t_pattern.machineId == UINT32_MAX)
+                throw AssemblerException("Peephole rule " + ruleA.name + ": Unknown command " + *t_tok, 1006);
+
+            for (++t_tok; t_tok != t_tokens.end(); ++t_tok)
+                {
+                    const std::string &t_op = *t_tok;
+
+                    if (t_op == "*")
+                        t_pattern.operands.push_back(Operand{Operand::KIND::ANY, 0});
+                    else if (std::isdigit(static_cast<unsigned char>(t_op.front())))
+                        {
+                            std::size_t t_pos{0};
+                            uint64_t t_val{0};
+
+                            try
+                                {
+                                    t_val = std::stoull(t_op, &t_pos, 0);
+                                }
+                            catch (const std::exception &)
+                                {
+                                    t_pos = 0;
+                                }
+
+                            if (t_pos != t_op.size())
+                                throw AssemblerException(
+                                    "Peephole rule " + ruleA.name + ": Invalid operand " + t_op, 1008);
+
+                            t_pattern.operands.push_back(Operand{Operand::KIND::LITERAL, t_val});
+                        }
+                    else
+                        {
+                            auto t_res = t_bindings.emplace(t_op, t_bindings.size());
+                            t_pattern.operands.push_back(Operand{Operand::KIND::BINDING, t_res.first->second});
+                        }
+                }
+
+            if (!t_pattern.operands.empty() && t_pattern.operands.size() != m_isa.getNumOperands(t_pattern.machineId))
+                throw AssemblerException(
+                    "Peephole rule " + ruleA.name + ": Wrong number of operands for " + command, 1008);
+
+            ruleA.match.push_back(std::move(t_pattern));
+        }
+
+    if (ruleA.match.empty())
+        throw AssemblerException("Peephole rule " + ruleA.name + ": Empty match pattern", 1008);
+
+    ruleA.numBindings = t_bindings.size();
+
+    return;
+}
+
+void Peephole::parseReplace(Rule &ruleA, const std::string &replaceA) const
+{
+    typedef boost::tokenizer<boost::char_separator<char>> tokenizer;
+
+    for (const auto &ref : tokenizer(replaceA, boost::char_separator<char>(" \t\n\r;")))
+        {
+            std::size_t t_pos{0};
+            unsigned long t_idx{0};
+
+            if (ref.size() > 1 && ref.front() == '$')
+                {
+                    try
+                        {
+                            t_idx = std::stoul(ref.substr(1), &t_pos, 10);
+                        }
+                    catch (const std::exception &)
+                        {
+                            t_pos = 0;
+                        }
+                }
+
+            if (t_pos == 0 || t_pos != ref.size() - 1 || t_idx == 0 || t_idx > ruleA.match.size())
+                throw AssemblerException("Peephole rule " + ruleA.name + ": Invalid reference " + ref, 1008);
+
+            ruleA.keep.push_back(t_idx - 1);
+        }
+
+    if (ruleA.keep.size() >= ruleA.match.size())
+        throw AssemblerException("Peephole rule " + ruleA.name + ": Replacement has to be shorter than match", 1007);
+
+    return;
+}
+
+std::vector<uint64_t> Peephole::getOperands(const uint64_t wordA) const
+{
+    switch (m_isa.getNumOperands(m_isa.getMachineCode(wordA)))
+        {
+        case 1:
+            return {m_isa.getLine(wordA)};
+        case 2:
+            return {m_isa.getAddress(wordA), m_isa.getLine(wordA)};
+        case 3:
+            return {m_isa.getAddress(wordA), m_isa.getLine(wordA), m_isa.getPlace(wordA)};
+        default:
+            return {};
+        }
+}
+
+bool Peephole::matches(const Rule &ruleA, const std::vector<Instruction> &instsA, const std::size_t endA) const
+{
+    if (endA < ruleA.match.size())
+        return false;
+
+    const std::size_t t_begin = endA - ruleA.match.size();
+    std::vector<uint64_t> t_values(ruleA.numBindings, 0);
+    std::vector<bool> t_bound(ruleA.numBindings, false);
+
+    // Compare from the end, because the last instruction is new and fails most often
+    for (std::size_t k = ruleA.match.size(); k-- > 0;)
+        {
+            const auto &t_pattern = ruleA.match[k];
+            const uint64_t t_word = instsA[t_begin + k].word;
+
+            if (m_isa.getMachineCode(t_word) != t_pattern.machineId)
+                return false;
+
+            if (t_pattern.operands.empty())
+                continue;
+
+            const auto t_ops = getOperands(t_word);
+
+            for (std::size_t j = 0; j < t_pattern.operands.size(); ++j)
+                {
+                    const auto &t_op = t_pattern.operands[j];
+
+                    switch (t_op.kind)
+                        {
+                        case Operand::KIND::LITERAL:
+                            if (t_ops[j] != t_op.value)
+                                return false;
+                            break;
+                        case Operand::KIND::BINDING:
+                            if (t_bound[t_op.value] && t_values[t_op.value] != t_ops[j])
+                                return false;
+                            t_values[t_op.value] = t_ops[j];
+                            t_bound[t_op.value] = true;
+                            break;
+                        case Operand::KIND::ANY:
+                        default:
+                            break;
+                        }
+                }
+        }
+
+    return true;
+}
+
+} /* End namespace as */
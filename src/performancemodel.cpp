@@ -0,0 +1,155 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "performancemodel.h"
+#include "loop.h"
+#include "myException.h"
+#include "nooperand.h"
+#include "oneoperand.h"
+#include "parseobjectconst.h"
+#include "parseobjectvariable.h"
+#include "threeoperand.h"
+#include "twooperand.h"
+#include <algorithm>
+#include <iomanip>
+
+namespace
+{
+
+/**
+ * @brief Get current value of a loop range operand.
+ */
+int64_t getValue(const as::ParseObjBase *objA)
+{
+    if (objA->getCommandClass() == as::COMMANDCLASS::CONSTANT)
+        return static_cast<const as::ParseObjectConst *>(objA)->getConstValue();
+    else if (objA->getCommandClass() == as::COMMANDCLASS::VARIABLE)
+        return static_cast<const as::ParseObjectVariable *>(objA)->getVariableValue();
+
+    throw as::AssemblerException("Error: Invalid type for parse object. It's neither a constant no a variable", 8019);
+}
+
+} // end of anonymous namespace
+
+namespace as
+{
+
+PerformanceModel::PerformanceModel(const InstructionSet &isaA, const boost::property_tree::ptree &configA)
+    : m_model{isaA, configA}, m_cycles{0}
+{
+    return;
+}
+
+uint64_t PerformanceModel::run(const Level *const levelA)
+{
+    m_loops.clear();
+    m_cycles = estimate(levelA, 1, 0);
+
+    return m_cycles;
+}
+
+uint64_t PerformanceModel::getCycles(void) const
+{
+    return m_cycles;
+}
+
+void PerformanceModel::report(std::ostream &osA) const
+{
+    std::vector<const Estimate *> t_ranked{};
+
+    for (const auto &loop : m_loops)
+        t_ranked.push_back(&loop);
+
+    std::stable_sort(t_ranked.begin(), t_ranked.end(),
+                     [](const Estimate *lhsA, const Estimate *rhsA) { return lhsA->total > rhsA->total; });
+
+    osA << "Loops by estimated cycles:" << std::endl;
+
+    uint64_t t_rank{0};
+
+    for (const auto est : t_ranked)
+        {
+            const double t_share = m_cycles > 0 ? 100.0 * est->total / m_cycles : 0.0;
+
+            osA << "    " << ++t_rank << ". " << est->loop->getReadCommandLine() << " (line "
+                << est->loop->getFileLine() << ", depth " << est->depth << "): " << est->total << " cycles ("
+                << std::fixed << std::setprecision(1) << t_share << std::defaultfloat << "%), " << est->entries
+                << " entries x " << est->trips << " iterations x " << est->perIter << " cycles" << std::endl;
+        }
+
+    return;
+}
+
+uint64_t PerformanceModel::estimate(const Level *const levelA, const uint64_t entriesA, const uint64_t depthA)
+{
+    LatencyModel::State t_state{0, 0};
+    uint64_t lvlId{0};
+
+    for (const auto po : levelA->getParseObjList())
+        {
+            switch (po->getCommandClass())
+                {
+                case COMMANDCLASS::NOOPERAND:
+                    m_model.issueCommand(t_state, static_cast<const NoOperand *>(po)->getMachineCodeId());
+                    break;
+                case COMMANDCLASS::ONEOPERAND:
+                    m_model.issueCommand(t_state, static_cast<const OneOperand *>(po)->getMachineCodeId());
+                    break;
+                case COMMANDCLASS::TWOOPERAND:
+                    m_model.issueCommand(t_state, static_cast<const TwoOperand *>(po)->getMachineCodeId());
+                    break;
+                case COMMANDCLASS::THREEOPERAND:
+                    m_model.issueCommand(t_state, static_cast<const ThreeOperand *>(po)->getMachineCodeId());
+                    break;
+                case COMMANDCLASS::LOOP:
+                    {
+                        const Loop *t_loop = static_cast<const Loop *>(levelA->at(lvlId++));
+                        const uint64_t t_trips = getTrips(t_loop);
+                        const uint64_t t_perIter = estimate(t_loop, entriesA * t_trips, depthA + 1);
+
+                        m_loops.push_back(Estimate{t_loop, depthA + 1, entriesA, t_trips, t_perIter,
+                                                   entriesA * t_trips * t_perIter});
+
+                        // Loop body finishes its computations, thus the loop is executed serially
+                        t_state.cycle = std::max(t_state.cycle, t_state.fabricReady) + t_trips * t_perIter;
+                        break;
+                    }
+                default:
+                    break;
+                }
+        }
+
+    return std::max(t_state.cycle, t_state.fabricReady);
+}
+
+uint64_t PerformanceModel::getTrips(const Loop *const loopA)
+{
+    // Same loop condition as Loop::updateLoopIndex, body runs at least once
+    const int64_t t_start = getValue(loopA->getStartValue());
+    const int64_t t_end = getValue(loopA->getEndValue());
+    const int64_t t_step = getValue(loopA->getStepWidth());
+
+    if (t_step > 0 && t_end > t_start)
+        return (t_end - t_start + t_step - 1) / t_step;
+
+    if (t_step < 0 && t_start > t_end)
+        return (t_start - t_end - t_step - 1) / -t_step;
+
+    return 1;
+}
+
+} /* End namespace as */
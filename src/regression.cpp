@@ -0,0 +1,345 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "regression.h"
+#include "instructionset.h"
+#include "myException.h"
+#include <boost/filesystem/fstream.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+#include <chrono>
+#include <cinttypes>
+#include <cstdio>
+#include <fcntl.h>
+#include <iomanip>
+#include <sstream>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+
+/**
+ * @brief Format hash as hexadecimal string.
+ */
+std::string toHex(const uint64_t hashA)
+{
+    char t_buf[24];
+    std::snprintf(t_buf, sizeof(t_buf), "0x%016" PRIX64, hashA);
+
+    return std::string{t_buf};
+}
+
+} // end of anonymous namespace
+
+namespace as
+{
+
+Regression::Regression(const boost::filesystem::path &assemblerA, const boost::filesystem::path &workDirA)
+    : m_assembler{assemblerA}, m_workDir{workDirA}, m_tolerance{0.25}, m_timeSlack{50.0}, m_rssSlack{4096},
+      m_corpusDir{}, m_cases{}, m_baseline{}, m_hashes{}
+{
+    return;
+}
+
+void Regression::setTolerance(const double toleranceA, const double timeSlackA, const uint64_t rssSlackA)
+{
+    m_tolerance = toleranceA;
+    m_timeSlack = timeSlackA;
+    m_rssSlack = rssSlackA;
+
+    return;
+}
+
+void Regression::loadCorpus(const boost::filesystem::path &corpusA)
+{
+    boost::filesystem::ifstream t_is{corpusA};
+
+    if (!t_is)
+        throw AssemblerException("Regression: Cannot open corpus file " + corpusA.string(), 1014);
+
+    m_corpusDir = corpusA.parent_path();
+    std::string t_line{};
+    uint64_t t_count{0};
+
+    while (std::getline(t_is, t_line))
+        {
+            ++t_count;
+
+            std::istringstream t_fields{t_line};
+            std::string t_program{}, t_config{}, t_hash{};
+            Case t_case{};
+
+            if (!(t_fields >> t_case.name) || t_case.name[0] == '#')
+                continue;
+
+            if (!(t_fields >> t_program >> t_config >> t_hash))
+                throw AssemblerException(
+                    "Regression: Malformed corpus line " + std::to_string(t_count) + " in " + corpusA.string(), 1014);
+
+            t_case.program = t_program;
+            t_case.config = t_config;
+            t_case.hash = std::stoull(t_hash, nullptr, 16);
+
+            for (std::string t_arg; t_fields >> t_arg;)
+                t_case.args.push_back(t_arg);
+
+            m_cases.push_back(std::move(t_case));
+        }
+
+    return;
+}
+
+void Regression::loadBaseline(const boost::filesystem::path &baselineA)
+{
+    boost::filesystem::ifstream t_is{baselineA};
+    std::string t_line{};
+
+    while (std::getline(t_is, t_line))
+        {
+            std::istringstream t_fields{t_line};
+            std::string t_name{};
+            Usage t_usage{0.0, 0};
+
+            if (!(t_fields >> t_name) || t_name[0] == '#')
+                continue;
+
+            if (!(t_fields >> t_usage.milliseconds >> t_usage.rss))
+                throw AssemblerException("Regression: Malformed baseline entry " + t_name, 1014);
+
+            m_baseline[t_name] = t_usage;
+        }
+
+    return;
+}
+
+void Regression::writeBaseline(const boost::filesystem::path &baselineA) const
+{
+    boost::filesystem::ofstream t_os{baselineA};
+
+    if (!t_os)
+        throw AssemblerException("Regression: Cannot write baseline file " + baselineA.string(), 1014);
+
+    t_os << "# name wall-time[ms] peak-rss[KiB]\n";
+
+    for (const auto &entry : m_baseline)
+        t_os << entry.first << " " << std::fixed << std::setprecision(3) << entry.second.milliseconds << " "
+             << entry.second.rss << "\n";
+
+    return;
+}
+
+uint64_t Regression::hash(const std::vector<uint64_t> &wordsA)
+{
+    uint64_t t_hash{0xCBF29CE484222325};
+
+    for (const uint64_t word : wordsA)
+        for (uint32_t b = 0; b < 8; ++b)
+            {
+                t_hash ^= (word >> (8 * b)) & 0xFF;
+                t_hash *= 0x100000001B3;
+            }
+
+    return t_hash;
+}
+
+std::vector<uint64_t> Regression::execute(const Case &caseA, Usage &usageA) const
+{
+    // Configuration copy writes output to work directory
+    boost::property_tree::ptree t_config{};
+    boost::property_tree::read_xml((m_corpusDir / caseA.config).string(), t_config);
+
+    const boost::filesystem::path t_output{m_workDir / (caseA.name + ".hpp")};
+    const boost::filesystem::path t_configPath{m_workDir / (caseA.name + ".xml")};
+    const boost::filesystem::path t_logPath{m_workDir / (caseA.name + ".log")};
+
+    t_config.put("General.Output", t_output.string());
+    boost::property_tree::write_xml(t_configPath.string(), t_config);
+
+    std::vector<std::string> t_args{m_assembler.string(), "--file", (m_corpusDir / caseA.program).string(), "--config",
+                                    t_configPath.string(), "--log", t_logPath.string()};
+    t_args.insert(t_args.end(), caseA.args.begin(), caseA.args.end());
+
+    std::vector<char *> t_argv{};
+
+    for (auto &arg : t_args)
+        t_argv.push_back(&arg[0]);
+
+    t_argv.push_back(nullptr);
+
+    auto t_begin = std::chrono::steady_clock::now();
+    const pid_t t_pid = fork();
+
+    if (t_pid < 0)
+        throw AssemblerException("Regression: Cannot start assembler process", 1015);
+
+    if (t_pid == 0)
+        {
+            // Assembler logs progress to std::cout
+            const int t_null = open("/dev/null", O_WRONLY);
+            dup2(t_null, STDOUT_FILENO);
+            dup2(t_null, STDERR_FILENO);
+            execv(t_argv[0], t_argv.data());
+            _exit(127);
+        }
+
+    int t_status{0};
+    struct rusage t_usage
+    {
+    };
+
+    if (wait4(t_pid, &t_status, 0, &t_usage) != t_pid)
+        throw AssemblerException("Regression: Lost assembler process", 1015);
+
+    auto t_end = std::chrono::steady_clock::now();
+
+    usageA.milliseconds = std::chrono::duration<double, std::milli>(t_end - t_begin).count();
+    usageA.rss = static_cast<uint64_t>(t_usage.ru_maxrss);
+
+    if (!WIFEXITED(t_status) || WEXITSTATUS(t_status) != 0)
+        throw AssemblerException("Regression: Assembler failed, see " + t_logPath.string(), 1015);
+
+    return Simulator::readProgram(t_output);
+}
+
+void Regression::verify(const Case &caseA, const std::vector<uint64_t> &wordsA, std::vector<std::string> &errorsA)
+{
+    boost::property_tree::ptree t_config{};
+    boost::property_tree::read_xml((m_corpusDir / caseA.config).string(), t_config);
+
+    const InstructionSet t_isa{t_config};
+    Simulator t_sim{t_isa, t_config};
+    t_sim.run(wordsA);
+
+    const std::string t_program{caseA.program.string()};
+    auto t_ref = m_references.find(t_program);
+
+    // First case of a program is the reference
+    if (t_ref == m_references.end())
+        {
+            m_references[t_program] = std::make_pair(caseA.name, t_sim.getStatistics());
+            m_referenceMemory[t_program] = t_sim.getMemory();
+            return;
+        }
+
+    if (t_sim.getMemory() != m_referenceMemory[t_program])
+        errorsA.push_back("shared memory differs from " + t_ref->second.first);
+
+    if (t_sim.getStatistics().hazards > t_ref->second.second.hazards)
+        errorsA.push_back(std::to_string(t_sim.getStatistics().hazards) + " hazards exceed " +
+                          std::to_string(t_ref->second.second.hazards) + " of " + t_ref->second.first);
+
+    return;
+}
+
+bool Regression::run(std::ostream &logA, const std::string &filterA, const bool updateA)
+{
+    boost::filesystem::create_directories(m_workDir);
+    m_hashes.clear();
+    m_references.clear();
+    m_referenceMemory.clear();
+
+    uint32_t t_failed{0}, t_count{0};
+
+    for (const auto &cs : m_cases)
+        {
+            if (cs.name.find(filterA) == std::string::npos)
+                continue;
+
+            ++t_count;
+            logA << std::left << std::setw(28) << cs.name << std::right;
+
+            Usage t_usage{0.0, 0};
+            uint64_t t_hash{0};
+            std::vector<std::string> t_errors{};
+
+            try
+                {
+                    const std::vector<uint64_t> t_words = execute(cs, t_usage);
+
+                    t_hash = hash(t_words);
+                    verify(cs, t_words, t_errors);
+                }
+            catch (const std::exception &e)
+                {
+                    logA << "FAILED: " << e.what() << std::endl;
+                    ++t_failed;
+                    continue;
+                }
+
+            m_hashes[cs.name] = t_hash;
+
+            if (t_hash != cs.hash)
+                t_errors.push_back("hash " + toHex(t_hash) + " != golden " + toHex(cs.hash));
+
+            auto t_base = m_baseline.find(cs.name);
+
+            if (updateA || t_base == m_baseline.end())
+                m_baseline[cs.name] = t_usage;
+            else
+                {
+                    if (t_usage.milliseconds > t_base->second.milliseconds * (1.0 + m_tolerance) + m_timeSlack)
+                        {
+                            std::ostringstream t_msg{};
+                            t_msg << "wall time exceeds baseline of " << std::fixed << std::setprecision(1)
+                                  << t_base->second.milliseconds << " ms";
+                            t_errors.push_back(t_msg.str());
+                        }
+
+                    if (static_cast<double>(t_usage.rss) >
+                        static_cast<double>(t_base->second.rss) * (1.0 + m_tolerance) + m_rssSlack)
+                        t_errors.push_back("peak RSS exceeds baseline of " + std::to_string(t_base->second.rss) +
+                                           " KiB");
+                }
+
+            logA << std::fixed << std::setprecision(1) << std::setw(12) << t_usage.milliseconds << " ms"
+                 << std::setw(10) << t_usage.rss << " KiB  " << (t_errors.empty() ? "passed" : "FAILED");
+
+            for (const auto &error : t_errors)
+                logA << ", " << error;
+
+            logA << std::endl;
+            t_failed += !t_errors.empty();
+        }
+
+    logA << t_count - t_failed << " of " << t_count << " cases passed" << std::endl;
+
+    return t_failed == 0;
+}
+
+void Regression::writeHashes(std::ostream &osA) const
+{
+    for (const auto &cs : m_cases)
+        {
+            auto t_hash = m_hashes.find(cs.name);
+
+            if (t_hash == m_hashes.end())
+                continue;
+
+            osA << cs.name << " " << cs.program.string() << " " << cs.config.string() << " " << toHex(t_hash->second);
+
+            for (const auto &arg : cs.args)
+                osA << " " << arg;
+
+            osA << "\n";
+        }
+
+    return;
+}
+
+} /* End namespace as */
@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "myException.h"
+#include "regression.h"
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+#include <cstdlib>
+#include <iostream>
+
+int main(int argc, char *argv[])
+{
+    namespace po = boost::program_options;
+    //!< @brief Abbreviation for boost program options library.
+    namespace fs = boost::filesystem;
+    //!< @brief Abbreviation for boost file system library.
+
+    /* Define command line options for regression harness.
+       help: Shows cmd-tool options
+       assembler: Path to assembler executable.
+       corpus: Corpus file with cases and golden hashes.
+       baseline: Performance baseline of this machine (created, if missing).
+       work-dir: Directory for configurations, logs and output files.
+       filter: Run only cases whose name contains the filter.
+       update: Replace baseline entries by measured usage.
+       tolerance, time-slack, rss-slack: Limits of performance comparison.
+       print-hashes: Print corpus lines with the measured hashes to update golden values.
+     */
+    po::options_description desc("Usable options");
+    desc.add_options()("help,", "Show command line options and usability.")(
+        "assembler,", po::value<std::string>()->required(), "Path to assembler executable.")(
+        "corpus,", po::value<std::string>()->required(), "Corpus file with cases and golden hashes.")(
+        "baseline,", po::value<std::string>(), "Performance baseline file (created, if missing).")(
+        "work-dir,", po::value<std::string>()->default_value("regression"), "Directory for output files.")(
+        "filter,", po::value<std::string>()->default_value(""), "Run only cases whose name contains the filter.")(
+        "update,", "Replace baseline entries by measured usage.")(
+        "tolerance,", po::value<double>()->default_value(0.25), "Relative performance tolerance (0.25 = 25%).")(
+        "time-slack,", po::value<double>()->default_value(50.0), "Absolute wall time tolerance in milliseconds.")(
+        "rss-slack,", po::value<uint64_t>()->default_value(4096), "Absolute peak RSS tolerance in KiB.")(
+        "print-hashes,", "Print corpus lines with measured hashes.");
+
+    po::variables_map vm;
+    //!< \brief Variable map to store command line options.
+
+    try
+        {
+            po::store(po::parse_command_line(argc, argv, desc), vm);
+
+            if (vm.count("help") != 0U)
+                {
+                    std::cout << desc << std::endl;
+                    return EXIT_SUCCESS;
+                }
+
+            po::notify(vm);
+        }
+    catch (const po::error &e)
+        {
+            std::cout << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    bool t_passed{false};
+
+    try
+        {
+            as::Regression t_regression{fs::absolute(vm["assembler"].as<std::string>()),
+                                        fs::absolute(vm["work-dir"].as<std::string>())};
+
+            t_regression.setTolerance(vm["tolerance"].as<double>(), vm["time-slack"].as<double>(),
+                                      vm["rss-slack"].as<uint64_t>());
+            t_regression.loadCorpus(vm["corpus"].as<std::string>());
+
+            if (vm.count("baseline") != 0U)
+                t_regression.loadBaseline(vm["baseline"].as<std::string>());
+
+            t_passed = t_regression.run(std::cout, vm["filter"].as<std::string>(), vm.count("update") != 0U);
+
+            if (vm.count("baseline") != 0U)
+                t_regression.writeBaseline(vm["baseline"].as<std::string>());
+
+            if (vm.count("print-hashes") != 0U)
+                t_regression.writeHashes(std::cout);
+        }
+    catch (const as::AssemblerException &ce)
+        {
+            std::cout << ce.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+    catch (const std::exception &e)
+        {
+            std::cout << "Std. error: " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    return t_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -21,7 +21,7 @@
 #include <sstream>
 #include <utility>
 
-as::ResetVariable::ResetVariable(as::Level *const lvlA, const std::string &cmdLineA, const uint32_t lineNumberA,
+as::ResetVariable::ResetVariable(as::Level *const lvlA, const std::string &cmdLineA, const uint64_t lineNumberA,
                                  as::ParseObjBase *const valHandleA, as::ParseObjBase *const varhandleA)
     : as::ParseObjBase{lvlA, as::COMMANDCLASS::RESETVAR, cmdLineA, lineNumberA}, m_varHandle(varhandleA),
       m_valHandle(valHandleA)
@@ -99,4 +99,14 @@ std::ostream &operator<<(std::ostream &osA, const as::ResetVariable &opA)
 {
     osA << static_cast<const as::ParseObjBase &>(opA) << "; ";
     return osA;
-}
\ No newline at end of file
+}
+
+as::ParseObjBase *as::ResetVariable::getVariable(void) const
+{
+    return m_varHandle;
+}
+
+as::ParseObjBase *as::ResetVariable::getValue(void) const
+{
+    return m_valHandle;
+}
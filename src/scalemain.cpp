@@ -0,0 +1,274 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "kernelgenerator.h"
+#include "myException.h"
+#include "simulator.h"
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/program_options.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fcntl.h>
+#include <iostream>
+#include <string>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+namespace fs = boost::filesystem;
+namespace pt = boost::property_tree;
+
+/**
+ * @brief Generate a program with at least the requested number of lines or machine code words.
+ *
+ * @details
+ * A program for a line target is a flat body, a program for a word target nests two
+ * loops around a small body. The body length or the loop iterations are scaled until
+ * the generated program reaches the target.
+ *
+ * @param[in] pathA Path of generated assembler file.
+ * @param[in] linesA Minimal number of source lines (0 = no line target).
+ * @param[in] wordsA Minimal number of machine code words (0 = no word target).
+ * @param[out] genA Generator with line and word count of the program.
+ */
+void generate(const fs::path &pathA, const uint64_t linesA, const uint64_t wordsA, as::KernelGenerator &genA)
+{
+    as::KernelGenerator::Parameters t_param{};
+    t_param.depth = linesA != 0 ? 0 : 2;
+    t_param.trips = 8;
+    t_param.body = 64;
+
+    for (;;)
+        {
+            fs::ofstream t_os{pathA};
+            genA.generate(t_param, t_os);
+
+            if (!t_os)
+                throw as::AssemblerException("Scaling: Cannot write " + pathA.string(), 1021);
+
+            if (linesA != 0 && genA.getLines() < linesA)
+                t_param.body = static_cast<uint32_t>(t_param.body * linesA / genA.getLines() + 1);
+            else if (wordsA != 0 && genA.getWords() < wordsA)
+                t_param.trips = static_cast<uint32_t>(
+                    std::ceil(t_param.trips * std::sqrt(static_cast<double>(wordsA) / genA.getWords())) + 1);
+            else
+                break;
+        }
+
+    return;
+}
+
+/**
+ * @brief Run the assembler in a child process with limited address space and CPU time.
+ *
+ * @param[in] argsA Command line of assembler (first entry is path to executable).
+ * @param[in] memoryA Limit of address space in MiB.
+ * @param[in] secondsA Limit of CPU time in seconds.
+ * @param[out] millisecondsA Wall time of assembler.
+ * @param[out] rssA Peak resident set size of assembler in KiB.
+ * @return True, if the assembler exited successfully.
+ */
+bool execute(std::vector<std::string> argsA, const uint64_t memoryA, const uint64_t secondsA, double &millisecondsA,
+             uint64_t &rssA)
+{
+    std::vector<char *> t_argv{};
+
+    for (auto &arg : argsA)
+        t_argv.push_back(&arg[0]);
+
+    t_argv.push_back(nullptr);
+
+    auto t_begin = std::chrono::steady_clock::now();
+    const pid_t t_pid = fork();
+
+    if (t_pid < 0)
+        throw as::AssemblerException("Scaling: Cannot start assembler process", 1021);
+
+    if (t_pid == 0)
+        {
+            const struct rlimit t_memory
+            {
+                memoryA << 20, memoryA << 20
+            };
+            const struct rlimit t_cpu
+            {
+                secondsA, secondsA
+            };
+
+            // Assembler logs progress to std::cout
+            const int t_null = open("/dev/null", O_WRONLY);
+            dup2(t_null, STDOUT_FILENO);
+            setrlimit(RLIMIT_AS, &t_memory);
+            setrlimit(RLIMIT_CPU, &t_cpu);
+            execv(t_argv[0], t_argv.data());
+            _exit(127);
+        }
+
+    int t_status{0};
+    struct rusage t_usage
+    {
+    };
+
+    if (wait4(t_pid, &t_status, 0, &t_usage) != t_pid)
+        throw as::AssemblerException("Scaling: Lost assembler process", 1021);
+
+    auto t_end = std::chrono::steady_clock::now();
+
+    millisecondsA = std::chrono::duration<double, std::milli>(t_end - t_begin).count();
+    rssA = static_cast<uint64_t>(t_usage.ru_maxrss);
+
+    if (WIFSIGNALED(t_status))
+        std::cout << "Assembler terminated by signal " << WTERMSIG(t_status) << std::endl;
+
+    return WIFEXITED(t_status) && WEXITSTATUS(t_status) == 0;
+}
+
+} // end of anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    namespace po = boost::program_options;
+    //!< @brief Abbreviation for boost program options library.
+
+    /* Define command line options for scaling test.
+       help: Shows cmd-tool options
+       assembler: Path to assembler executable.
+       config: Assembler configuration file.
+       work-dir: Directory for generated program and output files.
+       lines: Minimal number of source lines of generated program.
+       words: Minimal number of machine code words of generated program.
+       max-memory: Address space limit of assembler.
+       max-seconds: CPU and wall time limit of assembler.
+     */
+    po::options_description desc("Usable options");
+    desc.add_options()("help,", "Show command line options and usability.")(
+        "assembler,", po::value<std::string>()->required(), "Path to assembler executable.")(
+        "config,", po::value<std::string>()->default_value("examples/config.xml"), "Assembler configuration file.")(
+        "work-dir,", po::value<std::string>()->default_value("scaling"), "Directory for program and output files.")(
+        "lines,", po::value<uint64_t>()->default_value(0), "Minimal number of source lines (flat program).")(
+        "words,", po::value<uint64_t>()->default_value(0), "Minimal number of machine code words (nested loops).")(
+        "max-memory,", po::value<uint64_t>()->default_value(1024), "Address space limit of assembler in MiB.")(
+        "max-seconds,", po::value<uint64_t>()->default_value(300), "CPU and wall time limit of assembler in seconds.");
+
+    po::variables_map vm;
+    //!< \brief Variable map to store command line options.
+
+    try
+        {
+            po::store(po::parse_command_line(argc, argv, desc), vm);
+
+            if (vm.count("help") != 0U)
+                {
+                    std::cout << desc << std::endl;
+                    return EXIT_SUCCESS;
+                }
+
+            po::notify(vm);
+        }
+    catch (const po::error &e)
+        {
+            std::cout << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    const uint64_t t_lines = vm["lines"].as<uint64_t>();
+    const uint64_t t_words = vm["words"].as<uint64_t>();
+
+    if ((t_lines == 0) == (t_words == 0))
+        {
+            std::cout << "Give either option --lines or option --words." << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    bool t_passed{false};
+
+    try
+        {
+            const fs::path t_workDir{fs::absolute(vm["work-dir"].as<std::string>())};
+            const std::string t_name{t_lines != 0 ? "lines" : "words"};
+            const fs::path t_program{t_workDir / (t_name + ".asm")};
+            const fs::path t_output{t_workDir / (t_name + ".hpp")};
+            const fs::path t_configPath{t_workDir / (t_name + ".xml")};
+            const fs::path t_logPath{t_workDir / (t_name + ".log")};
+            pt::ptree t_config{};
+
+            pt::read_xml(vm["config"].as<std::string>(), t_config);
+            fs::create_directories(t_workDir);
+
+            as::KernelGenerator t_gen{t_config};
+            generate(t_program, t_lines, t_words, t_gen);
+
+            std::cout << "Generated " << t_gen.getLines() << " lines, " << t_gen.getWords()
+                      << " machine code words after unrolling" << std::endl;
+
+            // Configuration copy writes output to work directory
+            t_config.put("General.Output", t_output.string());
+            pt::write_xml(t_configPath.string(), t_config);
+
+            double t_milliseconds{0.0};
+            uint64_t t_rss{0};
+            const uint64_t t_seconds = vm["max-seconds"].as<uint64_t>();
+
+            t_passed = execute({fs::absolute(vm["assembler"].as<std::string>()).string(), "--file",
+                                t_program.string(), "--config", t_configPath.string(), "--log", t_logPath.string(),
+                                "-O0"},
+                               vm["max-memory"].as<uint64_t>(), t_seconds, t_milliseconds, t_rss);
+
+            std::cout << "Assembled in " << t_milliseconds << " ms, peak RSS " << t_rss << " KiB" << std::endl;
+
+            if (!t_passed)
+                std::cout << "FAILED: Assembler failed or exceeded limits, see " << t_logPath.string() << std::endl;
+            else if (t_milliseconds > t_seconds * 1000.0)
+                {
+                    std::cout << "FAILED: Wall time exceeds " << t_seconds << " s" << std::endl;
+                    t_passed = false;
+                }
+            else if (as::Simulator::readProgram(t_output).size() != t_gen.getWords())
+                {
+                    std::cout << "FAILED: Output does not contain " << t_gen.getWords() << " words" << std::endl;
+                    t_passed = false;
+                }
+            else
+                {
+                    std::cout << "passed" << std::endl;
+
+                    // Large outputs are not kept
+                    fs::remove(t_program);
+                    fs::remove(t_output);
+                }
+        }
+    catch (const as::AssemblerException &ce)
+        {
+            std::cout << ce.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+    catch (const std::exception &e)
+        {
+            std::cout << "Std. error: " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    return t_passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "selectelimination.h"
+#include <iterator>
+#include <vector>
+
+namespace as
+{
+
+SelectElimination::SelectElimination(const InstructionSet &isaA)
+    : m_selectIds{{isaA.getMachineId("SLCT_DIC_LINE"), isaA.getMachineId("SLCT_DOC_LINE"),
+                   isaA.getMachineId("SLCT_PECC_LINE"), isaA.getMachineId("SLCT_CHCC_LINE")}},
+      m_isa{isaA}
+{
+    return;
+}
+
+std::string SelectElimination::getName(void) const
+{
+    return "select-elimination";
+}
+
+uint64_t SelectElimination::run(InstructionStream &streamA)
+{
+    // Selected line per cache, UINT32_MAX if unknown at program start
+    std::array<uint32_t, 4> t_selected;
+    t_selected.fill(UINT32_MAX);
+
+    std::vector<Instruction> &t_insts = streamA.getInstructions();
+    auto t_out = t_insts.begin();
+
+    for (auto it = t_insts.begin(); it != t_insts.end(); ++it)
+        {
+            const auto t_id = m_isa.getMachineCode(it->word);
+            bool t_redundant{false};
+
+            for (std::size_t i = 0; i < m_selectIds.size(); ++i)
+                {
+                    if (m_selectIds[i] != UINT32_MAX && m_selectIds[i] == t_id)
+                        {
+                            const auto t_line = m_isa.getLine(it->word);
+
+                            t_redundant = t_selected[i] == t_line;
+                            t_selected[i] = t_line;
+                            break;
+                        }
+                }
+
+            if (!t_redundant)
+                *t_out++ = *it;
+        }
+
+    const uint64_t t_removed = std::distance(t_out, t_insts.end());
+    t_insts.erase(t_out, t_insts.end());
+
+    return t_removed;
+}
+
+} /* End namespace as */
@@ -0,0 +1,413 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "server.h"
+#include "assembler.h"
+#include "myException.h"
+#include <algorithm>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+#include <cerrno>
+#include <cstring>
+#include <iterator>
+#include <sstream>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+
+namespace fs = boost::filesystem;
+
+/**
+ * @brief Maximum payload size of a request frame in bytes.
+ */
+const uint64_t c_maxPayload{64ULL << 20};
+
+/**
+ * @brief Read frame header line from socket.
+ *
+ * @return False, if the connection is closed or the line is too long.
+ */
+bool readLine(const int fdA, std::string &lineA)
+{
+    char t_char{0};
+
+    lineA.clear();
+
+    while (lineA.size() < 1024)
+        {
+            if (read(fdA, &t_char, 1) != 1)
+                return false;
+
+            if (t_char == '\n')
+                return true;
+
+            lineA += t_char;
+        }
+
+    return false;
+}
+
+/**
+ * @brief Read payload of frame from socket.
+ *
+ * @return False, if the connection is closed before all bytes are read.
+ */
+bool readBytes(const int fdA, const uint64_t lengthA, std::string &bytesA)
+{
+    bytesA.resize(lengthA);
+
+    for (uint64_t t_done = 0; t_done < lengthA;)
+        {
+            const ssize_t t_read = read(fdA, &bytesA[t_done], lengthA - t_done);
+
+            if (t_read <= 0)
+                return false;
+
+            t_done += static_cast<uint64_t>(t_read);
+        }
+
+    return true;
+}
+
+/**
+ * @brief Write all bytes to socket.
+ */
+bool writeAll(const int fdA, const std::string &bytesA)
+{
+    for (std::size_t t_done = 0; t_done < bytesA.size();)
+        {
+            const ssize_t t_written = send(fdA, bytesA.data() + t_done, bytesA.size() - t_done, MSG_NOSIGNAL);
+
+            if (t_written <= 0)
+                return false;
+
+            t_done += static_cast<std::size_t>(t_written);
+        }
+
+    return true;
+}
+
+/**
+ * @brief Read content of a file.
+ */
+std::string readFile(const fs::path &pathA)
+{
+    fs::ifstream t_is{pathA, std::ios::binary};
+
+    if (!t_is)
+        throw as::AssemblerException("Server: Cannot read file " + pathA.string(), 1018);
+
+    return std::string{std::istreambuf_iterator<char>{t_is}, std::istreambuf_iterator<char>{}};
+}
+
+/**
+ * @brief Map of request options to configuration parameters.
+ */
+const std::map<std::string, std::string> c_overrides{{"format", "General.Format"},
+                                                     {"optimize", "General.Optimize"},
+                                                     {"shard-size", "General.ShardSize"},
+                                                     {"comments", "General.Comments"},
+                                                     {"log-level", "General.LogLevel"}};
+
+} // end of anonymous namespace
+
+namespace as
+{
+
+Server::Server(const boost::filesystem::path &socketPathA, const boost::property_tree::ptree &configA)
+    : m_socketPath{socketPathA}, m_config{configA},
+      m_workDir{fs::temp_directory_path() / fs::unique_path("cgra_serve_%%%%%%%%")}, m_configs{}, m_replies{},
+      m_requests{0}, m_hits{0}
+{
+    fs::create_directories(m_workDir);
+
+    return;
+}
+
+Server::~Server(void)
+{
+    boost::system::error_code t_ec;
+    fs::remove_all(m_workDir, t_ec);
+}
+
+void Server::run(std::ostream &osA)
+{
+    sockaddr_un t_addr{};
+    t_addr.sun_family = AF_UNIX;
+
+    if (m_socketPath.string().size() >= sizeof(t_addr.sun_path))
+        throw AssemblerException("Server: Socket path " + m_socketPath.string() + " is too long.", 1018);
+
+    std::strcpy(t_addr.sun_path, m_socketPath.c_str());
+
+    const int t_socket = socket(AF_UNIX, SOCK_STREAM, 0);
+
+    if (t_socket < 0)
+        throw AssemblerException("Server: Cannot create socket.", 1018);
+
+    unlink(m_socketPath.c_str());
+
+    if (bind(t_socket, reinterpret_cast<sockaddr *>(&t_addr), sizeof(t_addr)) != 0 || listen(t_socket, 16) != 0)
+        {
+            close(t_socket);
+            throw AssemblerException("Server: Cannot listen on socket " + m_socketPath.string() + ": " +
+                                         std::strerror(errno),
+                                     1018);
+        }
+
+    osA << "Listening on " << m_socketPath.string() << std::endl;
+
+    try
+        {
+            for (bool t_running = true; t_running;)
+                {
+                    const int t_conn = accept(t_socket, nullptr, nullptr);
+
+                    if (t_conn < 0)
+                        {
+                            if (errno == EINTR)
+                                continue;
+
+                            break;
+                        }
+
+                    // A failing connection does not stop the server
+                    try
+                        {
+                            t_running = serve(t_conn);
+                        }
+                    catch (const std::exception &e)
+                        {
+                            osA << "Connection closed after error: " << e.what() << std::endl;
+                        }
+
+                    close(t_conn);
+                }
+        }
+    catch (...)
+        {
+            close(t_socket);
+            unlink(m_socketPath.c_str());
+            throw;
+        }
+
+    close(t_socket);
+    unlink(m_socketPath.c_str());
+
+    osA << "Answered " << m_requests << " requests (" << m_hits << " from cache)" << std::endl;
+
+    return;
+}
+
+std::string Server::assemble(const std::string &payloadA)
+{
+    std::map<std::string, std::string> t_options{};
+    std::string t_source{};
+    std::time_t t_modified{0};
+    std::string t_reply{};
+
+    ++m_requests;
+
+    try
+        {
+            // Options until empty line, remaining payload is inline source
+            std::size_t t_pos{0};
+
+            while (t_pos < payloadA.size())
+                {
+                    auto t_end = payloadA.find('\n', t_pos);
+
+                    if (t_end == std::string::npos)
+                        t_end = payloadA.size();
+
+                    const std::string t_line{payloadA.substr(t_pos, t_end - t_pos)};
+                    t_pos = t_end + 1;
+
+                    if (t_line.empty())
+                        break;
+
+                    const auto t_eq = t_line.find('=');
+
+                    if (t_eq == std::string::npos ||
+                        (t_line.substr(0, t_eq) != "config" && t_line.substr(0, t_eq) != "file" &&
+                         t_line.substr(0, t_eq) != "name" && c_overrides.count(t_line.substr(0, t_eq)) == 0))
+                        throw AssemblerException("Server: Unknown request option \"" + t_line + "\".", 1018);
+
+                    t_options[t_line.substr(0, t_eq)] = t_line.substr(t_eq + 1);
+                }
+
+            t_source = t_pos < payloadA.size() ? payloadA.substr(t_pos) : "";
+
+            const bool t_isFile = t_options.count("file") != 0U;
+            const auto &t_base = t_options.count("config") != 0U ? getConfig(t_options["config"], t_modified) : m_config;
+
+            if (t_isFile)
+                t_source = readFile(t_options["file"]);
+
+            // Look for reply of identical request (options, source and configuration)
+            const std::string t_key{payloadA.substr(0, std::min(t_pos, payloadA.size())) + '\0' +
+                                    std::to_string(t_modified) + '\0' + t_source};
+
+            const auto t_cached = m_replies.find(t_key);
+
+            if (t_cached != m_replies.end())
+                {
+                    ++m_hits;
+                    return t_cached->second;
+                }
+
+            // Assemble program in work directory
+            boost::property_tree::ptree t_config{t_base};
+
+            for (const auto &opt : c_overrides)
+                if (t_options.count(opt.first) != 0U)
+                    t_config.put(opt.second, t_options[opt.first]);
+
+            const std::string t_name{t_isFile ? fs::path{t_options["file"]}.stem().string()
+                                              : (t_options.count("name") != 0U ? t_options["name"] : "Assembler")};
+            const fs::path t_outDir{m_workDir / "out"};
+            fs::path t_file{t_isFile ? fs::path{t_options["file"]} : m_workDir / (t_name + ".asm")};
+
+            fs::remove_all(t_outDir);
+            fs::create_directories(t_outDir);
+            t_config.put("General.Output", (t_outDir / (t_name + ".hpp")).string());
+
+            if (!t_isFile)
+                {
+                    fs::ofstream t_os{t_file, std::ios::binary};
+                    t_os << t_source;
+                }
+
+            std::ostringstream t_log{};
+
+            try
+                {
+                    Assembler t_as{t_file, t_config, t_log};
+                    t_as.parse();
+                    t_as.assemble();
+
+                    std::vector<fs::path> t_files{fs::directory_iterator{t_outDir}, fs::directory_iterator{}};
+                    std::sort(t_files.begin(), t_files.end());
+
+                    for (const auto &file : t_files)
+                        t_reply += frame("FILE", readFile(file), file.filename().string());
+
+                    if (!t_log.str().empty())
+                        t_reply += frame("LOG", t_log.str());
+
+                    t_reply += frame("OK", "");
+                }
+            catch (const std::exception &e)
+                {
+                    if (!t_log.str().empty())
+                        t_reply += frame("LOG", t_log.str());
+
+                    t_reply += frame("ERROR", e.what());
+                }
+
+            // Bound memory of cache
+            if (m_replies.size() >= 256)
+                m_replies.clear();
+
+            m_replies.emplace(t_key, t_reply);
+        }
+    catch (const std::exception &e)
+        {
+            t_reply = frame("ERROR", e.what());
+        }
+
+    return t_reply;
+}
+
+std::string Server::frame(const std::string &typeA, const std::string &payloadA, const std::string &nameA)
+{
+    return typeA + " " + std::to_string(payloadA.size()) + (nameA.empty() ? "" : " " + nameA) + "\n" + payloadA;
+}
+
+bool Server::serve(const int fdA)
+{
+    std::string t_header{};
+    std::string t_payload{};
+
+    while (readLine(fdA, t_header))
+        {
+            std::istringstream t_is{t_header};
+            std::string t_type{};
+            uint64_t t_length{0};
+
+            if (!(t_is >> t_type >> t_length))
+                {
+                    writeAll(fdA, frame("ERROR", "Server: Malformed frame header \"" + t_header + "\"."));
+                    return true;
+                }
+
+            if (t_length > c_maxPayload)
+                {
+                    writeAll(fdA, frame("ERROR", "Server: Frame of " + std::to_string(t_length) +
+                                                     " bytes exceeds limit of " + std::to_string(c_maxPayload) +
+                                                     " bytes."));
+                    return true;
+                }
+
+            if (!readBytes(fdA, t_length, t_payload))
+                return true;
+
+            if (t_type == "SHUTDOWN")
+                {
+                    writeAll(fdA, frame("OK", ""));
+                    return false;
+                }
+            else if (t_type == "ASSEMBLE")
+                {
+                    if (!writeAll(fdA, assemble(t_payload)))
+                        return true;
+                }
+            else if (!writeAll(fdA, frame("ERROR", "Server: Unknown frame type \"" + t_type + "\".")))
+                {
+                    return true;
+                }
+        }
+
+    return true;
+}
+
+const boost::property_tree::ptree &Server::getConfig(const std::string &pathA, std::time_t &modifiedA)
+{
+    boost::system::error_code t_ec;
+    modifiedA = fs::last_write_time(pathA, t_ec);
+
+    if (t_ec)
+        throw AssemblerException("Server: Configuration file " + pathA + " is missing.", 1018);
+
+    auto t_entry = m_configs.find(pathA);
+
+    if (t_entry == m_configs.end() || t_entry->second.modified != modifiedA)
+        {
+            Config t_config{modifiedA, boost::property_tree::ptree{}};
+            boost::property_tree::read_xml(pathA, t_config.config);
+            m_configs[pathA] = std::move(t_config);
+            t_entry = m_configs.find(pathA);
+        }
+
+    return t_entry->second.config;
+}
+
+} /* End namespace as */
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "shardedwriter.h"
+#include "myException.h"
+#include "tracer.h"
+#include <algorithm>
+#include <fstream>
+
+namespace as
+{
+
+ShardedWriter::ShardedWriter(const boost::property_tree::ptree &configA)
+    : IOutputWriter{configA}, m_shardSize{configA.get<uint64_t>("General.ShardSize", 65536)}
+{
+    if (m_shardSize == 0)
+        throw AssemblerException("Option \"General.ShardSize\" needs to be greater than zero.", 4501);
+
+    return;
+}
+
+boost::filesystem::path ShardedWriter::getChunkPath(const boost::filesystem::path &outPathA, const uint64_t chunkA)
+{
+    auto t_path = outPathA;
+    t_path.replace_extension();
+    t_path += "_" + std::to_string(chunkA) + ".cpp";
+
+    return t_path;
+}
+
+std::vector<boost::filesystem::path> ShardedWriter::write(const InstructionStream &streamA,
+                                                          const boost::filesystem::path &outPathA)
+{
+    std::vector<boost::filesystem::path> t_files{outPathA};
+    const auto &t_instructions = streamA.getInstructions();
+    // An empty program still gets one (empty) chunk to keep the chunk table valid.
+    const uint64_t t_numChunks = t_instructions.empty() ? 1 : (t_instructions.size() + m_shardSize - 1) / m_shardSize;
+    const auto t_guard = getGuardName(outPathA);
+
+    // Write header with chunk table
+    std::filebuf t_fb;
+
+    if (t_fb.open(outPathA.c_str(), std::ios::out))
+        {
+            CGRA_TRACE_SPAN("flush", "output");
+            CGRA_TRACE_ARG("file", outPathA.string());
+            std::ostream t_header(&t_fb);
+
+            t_header << "#ifndef " << t_guard << "\n";
+            t_header << "#define " << t_guard << "\n\n\n";
+
+            writeInclude(t_header);
+            t_header << "#include <cstddef>\n\n";
+            t_header << "namespace cgra \n{\n\n";
+
+            t_header << "#ifndef CGRA_ASSEMBLY_CHUNK_T_\n";
+            t_header << "#define CGRA_ASSEMBLY_CHUNK_T_\n";
+            t_header << "struct assembly_chunk_t\n{\n";
+            t_header << "    const cgra::TopLevel::assembler_type_t *data;\n";
+            t_header << "    std::size_t size;\n";
+            t_header << "};\n";
+            t_header << "#endif //CGRA_ASSEMBLY_CHUNK_T_\n\n";
+
+            for (uint64_t t_chunk = 0; t_chunk < t_numChunks; ++t_chunk)
+                t_header << "extern const assembly_chunk_t assembly_chunk_" << t_chunk << ";\n";
+
+            t_header << "\nstatic const assembly_chunk_t *const assembly_chunks[] = {\n";
+
+            for (uint64_t t_chunk = 0; t_chunk < t_numChunks; ++t_chunk)
+                t_header << "&assembly_chunk_" << t_chunk << ",\n";
+
+            t_header << "};\n\n";
+            t_header << "const std::size_t assembly_num_chunks = " << t_numChunks << ";\n";
+            t_header << "const std::size_t assembly_size = " << t_instructions.size() << ";\n\n";
+            t_header << "} //End namespace cgra\n\n";
+            t_header << "#endif //" << t_guard << "\n";
+            t_fb.close();
+        }
+    else
+        {
+            throw AssemblerException("Error while opening output file.", 4500);
+        }
+
+    // Write chunks
+    for (uint64_t t_chunk = 0; t_chunk < t_numChunks; ++t_chunk)
+        {
+            const auto t_chunkPath = getChunkPath(outPathA, t_chunk);
+            const uint64_t t_begin = t_chunk * m_shardSize;
+            const uint64_t t_end = std::min<uint64_t>(t_begin + m_shardSize, t_instructions.size());
+
+            if (t_fb.open(t_chunkPath.c_str(), std::ios::out))
+                {
+                    CGRA_TRACE_SPAN("flush", "output");
+                    CGRA_TRACE_ARG("file", t_chunkPath.string());
+                    CGRA_TRACE_ARG("words", t_end - t_begin);
+                    std::ostream t_codeFile(&t_fb);
+
+                    t_codeFile << "#include \"" << outPathA.filename().string() << "\"\n\n";
+                    t_codeFile << "namespace cgra \n{\n\n";
+
+                    if (t_begin == t_end)
+                        {
+                            t_codeFile << "extern const assembly_chunk_t assembly_chunk_" << t_chunk
+                                       << " = {nullptr, 0};\n\n";
+                        }
+                    else
+                        {
+                            t_codeFile << "static const cgra::TopLevel::assembler_type_t chunk[] = {\n";
+
+                            for (uint64_t t_idx = t_begin; t_idx < t_end; ++t_idx)
+                                writeStringWord(t_codeFile, t_instructions[t_idx]);
+
+                            t_codeFile << "};\n\n";
+                            t_codeFile << "extern const assembly_chunk_t assembly_chunk_" << t_chunk
+                                       << " = {chunk, sizeof(chunk) / sizeof(chunk[0])};\n\n";
+                        }
+
+                    t_codeFile << "} //End namespace cgra\n";
+                    t_fb.close();
+                }
+            else
+                {
+                    throw AssemblerException("Error while opening output file.", 4500);
+                }
+
+            t_files.push_back(t_chunkPath);
+        }
+
+    return t_files;
+}
+
+} /* End namespace as */
@@ -0,0 +1,156 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "instructionset.h"
+#include "myException.h"
+#include "simulator.h"
+#include <boost/filesystem.hpp>
+#include <boost/program_options.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+
+/**
+ * \brief Simulate machine code created by the assembler and report statistics.
+ *
+ * \param[in] argc Number of command line arguments.
+ * \param[in] argv Vector containing command line arguments.
+ * \return EXIT_SUCCESS, or EXIT_FAILURE on errors and failed verification.
+ */
+int main(int argc, char **argv)
+{
+    namespace po = boost::program_options;
+    //!< @brief Abbreviation for boost program option library.
+    namespace fs = boost::filesystem;
+    //!< @brief Abbreviation for boost file system library.
+    namespace pt = boost::property_tree;
+    //!< @brief Abbreviation for boost property tree library.
+    pt::ptree parsed_options{};
+    //!< @brief Property map with configuration options from config file.
+
+    /* Define command line options for cmd-tool.
+       help: Shows cmd-tool options
+       program: Output file of assembler (vector, constexpr or header of sharded format).
+       config: Program configuration file search path. (default=./config.cfg)
+       reference: Output file of a reference program to compare the shared memory with.
+       seed: Seed of initial shared memory content.
+     */
+    po::options_description desc("Usable options");
+    desc.add_options()("help,", "Show command line options and usability.")(
+        "program,", po::value<std::string>()->required(), "Output file of assembler to simulate.")(
+        "config,", po::value<std::string>()->default_value("./config.cfg"), "Assembler configuration file.")(
+        "reference,", po::value<std::string>(), "Output file of reference program (e.g. without optimization).")(
+        "seed,", po::value<uint64_t>()->default_value(1), "Seed of initial shared memory content.");
+
+    po::positional_options_description pos;
+    pos.add("program", 1);
+
+    /* Parse cmd-line arguments and store them in variables map.*/
+    po::variables_map vm;
+    //!< \brief Variable map to store command line options.
+    po::store(po::command_line_parser(argc, argv).options(desc).positional(pos).run(), vm);
+
+    // If help is within vm, show description.
+    if (vm.count("help") != 0U)
+        {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+
+    po::notify(vm);
+
+    /* Create file system path variable to validate configuration file.*/
+    fs::path configPtr{vm["config"].as<std::string>().c_str()};
+    //!< \brief Handle path to configuration file.
+    if (!fs::is_regular_file(configPtr) || configPtr.extension() != ".xml")
+        {
+            std::cout << "Program configuration file " << configPtr.string() << " is missing or invalid."
+                      << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    try
+        {
+            pt::read_xml(configPtr.string(), parsed_options);
+
+            as::InstructionSet t_isa{parsed_options};
+            as::Simulator t_sim{t_isa, parsed_options, vm["seed"].as<uint64_t>()};
+
+            const auto t_program = as::Simulator::readProgram(fs::path{vm["program"].as<std::string>()});
+
+            auto t_begin = std::chrono::steady_clock::now();
+            t_sim.run(t_program);
+            auto t_end = std::chrono::steady_clock::now();
+
+            const double t_seconds = std::chrono::duration<double>(t_end - t_begin).count();
+
+            t_sim.report(std::cout);
+
+            if (t_seconds > 0.0)
+                std::cout << "Simulation speed: " << t_sim.getStatistics().instructions / t_seconds / 1e6
+                          << " million instructions per second" << std::endl;
+
+            if (vm.count("reference") != 0U)
+                {
+                    as::Simulator t_ref{t_isa, parsed_options, vm["seed"].as<uint64_t>()};
+                    t_ref.run(as::Simulator::readProgram(fs::path{vm["reference"].as<std::string>()}));
+
+                    const auto &t_mem = t_sim.getMemory();
+                    const auto &t_refMem = t_ref.getMemory();
+                    uint64_t t_diffs{0}, t_first{0};
+
+                    for (uint64_t i = 0; i < t_mem.size(); ++i)
+                        {
+                            if (t_mem[i] != t_refMem[i] && t_diffs++ == 0)
+                                t_first = i;
+                        }
+
+                    const bool t_hazards = t_sim.getStatistics().hazards > t_ref.getStatistics().hazards;
+
+                    std::cout << "Reference cycles: " << t_ref.getStatistics().cycles << std::endl;
+
+                    if (t_diffs != 0 || t_hazards)
+                        {
+                            std::cout << "Verification failed: " << t_diffs << " different bytes";
+
+                            if (t_diffs != 0)
+                                std::cout << ", first at address " << t_first;
+
+                            std::cout << ", hazards " << t_sim.getStatistics().hazards << " (reference "
+                                      << t_ref.getStatistics().hazards << ")" << std::endl;
+
+                            return EXIT_FAILURE;
+                        }
+
+                    std::cout << "Verification passed: shared memory equals reference." << std::endl;
+                }
+        }
+    catch (const as::AssemblerException &ce)
+        {
+            std::cout << ce.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+    catch (const std::exception &e)
+        {
+            std::cout << "Std. error: " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    return EXIT_SUCCESS;
+}
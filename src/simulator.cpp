@@ -0,0 +1,390 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "simulator.h"
+#include "myException.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+
+namespace
+{
+
+/**
+ * @brief Mix bits of a value (splitmix64 finalizer).
+ */
+inline uint64_t mix(uint64_t valueA)
+{
+    valueA += 0x9E3779B97F4A7C15ULL;
+    valueA = (valueA ^ (valueA >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    valueA = (valueA ^ (valueA >> 27)) * 0x94D049BB133111EBULL;
+
+    return valueA ^ (valueA >> 31);
+}
+
+} // namespace
+
+namespace as
+{
+
+Simulator::Simulator(const InstructionSet &isaA, const boost::property_tree::ptree &configA, const uint64_t seedA)
+    : m_model{isaA, configA}, m_kinds(1u << isaA.getOpCodeSize(), KIND::UNKNOWN),
+      m_selectIdx(1u << isaA.getOpCodeSize(), 0), m_seed{seedA},
+      m_dicLines{configA.get<uint32_t>("VCGRA_Property.Num_Dic_Lines", 0)},
+      m_dicPlaces{configA.get<uint32_t>("VCGRA_Property.Num_Dic_Places", 0)},
+      m_docLines{configA.get<uint32_t>("VCGRA_Property.Num_Doc_Lines", 0)},
+      m_docPlaces{configA.get<uint32_t>("VCGRA_Property.Num_Doc_Places", 0)},
+      m_pcLines{configA.get<uint32_t>("VCGRA_Property.Num_PC_Lines", 0)},
+      m_ccLines{configA.get<uint32_t>("VCGRA_Property.Num_CC_Lines", 0)},
+      m_dicStride{configA.get<uint64_t>("VCGRA_Property.Dic_Place_Stride", 1)},
+      m_docStride{configA.get<uint64_t>("VCGRA_Property.Doc_Place_Stride", 1)},
+      m_busy{false}, m_isa{isaA}
+{
+    const auto t_memory = configA.get_optional<uint64_t>("VCGRA_Property.Available_Memory");
+
+    if (!t_memory)
+        throw AssemblerException("Simulation: Available_Memory is missing in configuration file", 1100);
+
+    m_memory.resize(*t_memory);
+
+    // A place holds at most one 64 bit value
+    if (m_dicStride == 0 || m_dicStride > 8 || m_docStride == 0 || m_docStride > 8)
+        throw AssemblerException("Simulation: Dic_Place_Stride and Doc_Place_Stride have to be in range 1 to 8", 1105);
+
+    const std::array<std::pair<const char *, KIND>, 10> t_kinds{
+        {{"NOOP", KIND::NOOP},
+         {"START", KIND::START},
+         {"WAIT_READY", KIND::WAIT},
+         {"FINISH", KIND::FINISH},
+         {"LOADD", KIND::LOADD},
+         {"LOADDA", KIND::LOADDA},
+         {"STORED", KIND::STORED},
+         {"STOREDA", KIND::STOREDA},
+         {"LOADPC", KIND::LOADPC},
+         {"LOADCC", KIND::LOADCC}}};
+
+    for (const auto &kind : t_kinds)
+        {
+            const auto t_id = m_isa.getMachineId(kind.first);
+
+            if (t_id < m_kinds.size())
+                m_kinds[t_id] = kind.second;
+        }
+
+    const std::array<const char *, 4> t_selects{{"SLCT_DIC_LINE", "SLCT_DOC_LINE", "SLCT_PECC_LINE", "SLCT_CHCC_LINE"}};
+
+    for (uint32_t c = 0; c < t_selects.size(); ++c)
+        {
+            const auto t_id = m_isa.getMachineId(t_selects[c]);
+
+            if (t_id < m_kinds.size())
+                {
+                    m_kinds[t_id] = KIND::SELECT;
+                    m_selectIdx[t_id] = c;
+                }
+        }
+
+    reset();
+
+    return;
+}
+
+void Simulator::reset(void)
+{
+    // Deterministic memory content, thus programs are comparable
+    for (uint64_t i = 0; i < m_memory.size(); i += 8)
+        {
+            const uint64_t t_val = mix(m_seed ^ mix(i));
+
+            for (uint64_t b = 0; b < 8 && i + b < m_memory.size(); ++b)
+                m_memory[i + b] = static_cast<uint8_t>(t_val >> (8 * b));
+        }
+
+    m_dic.assign(static_cast<uint64_t>(m_dicLines) * m_dicPlaces, 0);
+    m_doc.assign(static_cast<uint64_t>(m_docLines) * m_docPlaces, 0);
+    m_pc.assign(m_pcLines, 0);
+    m_cc.assign(m_ccLines, 0);
+    m_selected.fill(0);
+    m_running.fill(0);
+    m_outputs.assign(m_docPlaces, 0);
+    m_busy = false;
+    m_stats = Statistics{0, std::vector<uint64_t>(m_kinds.size(), 0), 0, 0, 0, 0, 0, 0};
+
+    return;
+}
+
+void Simulator::run(const std::vector<uint64_t> &programA)
+{
+    reset();
+
+    LatencyModel::State t_state{0, 0};
+
+    for (uint64_t k = 0; k < programA.size(); ++k)
+        {
+            const uint64_t t_word = programA[k];
+            const uint32_t t_id = m_isa.getMachineCode(t_word);
+            const uint32_t t_line = m_isa.getLine(t_word);
+            const uint64_t t_addr = m_isa.getAddress(t_word);
+
+            ++m_stats.instructions;
+            ++m_stats.perCommand[t_id];
+            m_model.issue(t_state, t_word);
+
+            switch (m_kinds[t_id])
+                {
+                case KIND::NOOP:
+                    break;
+                case KIND::START:
+                    if (m_busy)
+                        {
+                            ++m_stats.hazards;
+                            complete();
+                        }
+                    compute();
+                    break;
+                case KIND::WAIT:
+                    complete();
+                    break;
+                case KIND::FINISH:
+                    complete();
+                    k = programA.size();
+                    break;
+                case KIND::LOADD:
+                    {
+                        const uint32_t t_place = m_isa.getPlace(t_word);
+                        check(t_line, m_dicLines, t_place, m_dicPlaces, k);
+                        m_stats.hazards += m_busy && t_line == m_running[0];
+                        m_dic[t_line * m_dicPlaces + t_place] = load(t_addr, m_dicStride, k);
+                        m_stats.bytesLoaded += m_dicStride;
+                        break;
+                    }
+                case KIND::LOADDA:
+                    check(t_line, m_dicLines, 0, m_dicPlaces, k);
+                    m_stats.hazards += m_busy && t_line == m_running[0];
+                    for (uint32_t p = 0; p < m_dicPlaces; ++p)
+                        m_dic[t_line * m_dicPlaces + p] = load(t_addr + p * m_dicStride, m_dicStride, k);
+                    m_stats.bytesLoaded += m_dicPlaces * m_dicStride;
+                    break;
+                case KIND::STORED:
+                    {
+                        const uint32_t t_place = m_isa.getPlace(t_word);
+                        check(t_line, m_docLines, t_place, m_docPlaces, k);
+                        m_stats.hazards += m_busy && t_line == m_running[1];
+                        store(t_addr, m_docStride, m_doc[t_line * m_docPlaces + t_place], k);
+                        m_stats.bytesStored += m_docStride;
+                        break;
+                    }
+                case KIND::STOREDA:
+                    check(t_line, m_docLines, 0, m_docPlaces, k);
+                    m_stats.hazards += m_busy && t_line == m_running[1];
+                    for (uint32_t p = 0; p < m_docPlaces; ++p)
+                        store(t_addr + p * m_docStride, m_docStride, m_doc[t_line * m_docPlaces + p], k);
+                    m_stats.bytesStored += m_docPlaces * m_docStride;
+                    break;
+                case KIND::LOADPC:
+                    check(t_line, m_pcLines, 0, 1, k);
+                    m_stats.hazards += m_busy && t_line == m_running[2];
+                    m_pc[t_line] = mix(t_addr ^ load(t_addr, std::min<uint64_t>(8, m_memory.size() - t_addr), k));
+                    ++m_stats.configLoads;
+                    break;
+                case KIND::LOADCC:
+                    check(t_line, m_ccLines, 0, 1, k);
+                    m_stats.hazards += m_busy && t_line == m_running[3];
+                    m_cc[t_line] = mix(t_addr ^ load(t_addr, std::min<uint64_t>(8, m_memory.size() - t_addr), k));
+                    ++m_stats.configLoads;
+                    break;
+                case KIND::SELECT:
+                    {
+                        const auto t_cache = m_selectIdx[t_id];
+                        const std::array<uint32_t, 4> t_lines{{m_dicLines, m_docLines, m_pcLines, m_ccLines}};
+                        check(t_line, t_lines[t_cache], 0, 1, k);
+                        // Running computation uses the lines latched at START, thus a select is no hazard
+                        m_selected[t_cache] = t_line;
+                        break;
+                    }
+                case KIND::UNKNOWN:
+                default:
+                    throw AssemblerException("Simulation: Unknown machine code ID " + std::to_string(t_id) +
+                                                 " at word " + std::to_string(k),
+                                             1101);
+                }
+        }
+
+    complete();
+    m_stats.cycles = std::max(t_state.cycle, t_state.fabricReady);
+
+    return;
+}
+
+const std::vector<uint8_t> &Simulator::getMemory(void) const
+{
+    return m_memory;
+}
+
+const Simulator::Statistics &Simulator::getStatistics(void) const
+{
+    return m_stats;
+}
+
+void Simulator::report(std::ostream &osA) const
+{
+    osA << "Executed instructions: " << m_stats.instructions << std::endl;
+
+    for (uint32_t id = 0; id < m_stats.perCommand.size(); ++id)
+        {
+            if (m_stats.perCommand[id] > 0)
+                osA << "    " << m_isa.getName(id) << ": " << m_stats.perCommand[id] << std::endl;
+        }
+
+    osA << "Bytes loaded from shared memory: " << m_stats.bytesLoaded << std::endl;
+    osA << "Bytes stored to shared memory: " << m_stats.bytesStored << std::endl;
+    osA << "Configuration line loads: " << m_stats.configLoads << std::endl;
+    osA << "Computations: " << m_stats.computations << std::endl;
+    osA << "Hazards: " << m_stats.hazards << std::endl;
+    osA << "Estimated cycles: " << m_stats.cycles << std::endl;
+
+    return;
+}
+
+std::vector<uint64_t> Simulator::readProgram(const boost::filesystem::path &pathA)
+{
+    std::vector<uint64_t> t_words{};
+
+    if (!readWords(pathA, t_words))
+        throw AssemblerException("Simulation: Cannot open " + pathA.string(), 1102);
+
+    // Header of output format sharded lists chunk files only
+    if (t_words.empty())
+        {
+            for (uint64_t k = 0;; ++k)
+                {
+                    const auto t_chunk =
+                        pathA.parent_path() / (pathA.stem().string() + "_" + std::to_string(k) + ".cpp");
+
+                    if (!readWords(t_chunk, t_words))
+                        break;
+                }
+        }
+
+    if (t_words.empty())
+        throw AssemblerException("Simulation: No machine code words in " + pathA.string(), 1102);
+
+    return t_words;
+}
+
+bool Simulator::readWords(const boost::filesystem::path &pathA, std::vector<uint64_t> &wordsA)
+{
+    std::ifstream t_file(pathA.string());
+
+    if (!t_file.is_open())
+        return false;
+
+    std::string t_line{};
+
+    while (std::getline(t_file, t_line))
+        {
+            std::size_t t_pos = t_line.find_first_not_of(" \t\"");
+
+            // Initializer lines start with the hexadecimal word
+            if (t_pos == std::string::npos || t_line.compare(t_pos, 2, "0x") != 0)
+                continue;
+
+            wordsA.push_back(std::strtoull(t_line.c_str() + t_pos, nullptr, 16));
+        }
+
+    return true;
+}
+
+uint64_t Simulator::load(const uint64_t addrA, const uint64_t bytesA, const uint64_t wordIdxA)
+{
+    if (addrA > m_memory.size() || bytesA > m_memory.size() - addrA)
+        throw AssemblerException("Simulation: Shared memory address " + std::to_string(addrA) +
+                                     " out of range at word " + std::to_string(wordIdxA),
+                                 1103);
+
+    uint64_t t_val{0};
+
+    for (uint64_t b = 0; b < bytesA; ++b)
+        t_val |= static_cast<uint64_t>(m_memory[addrA + b]) << (8 * b);
+
+    return t_val;
+}
+
+void Simulator::store(const uint64_t addrA, const uint64_t bytesA, const uint64_t valueA, const uint64_t wordIdxA)
+{
+    if (addrA > m_memory.size() || bytesA > m_memory.size() - addrA)
+        throw AssemblerException("Simulation: Shared memory address " + std::to_string(addrA) +
+                                     " out of range at word " + std::to_string(wordIdxA),
+                                 1103);
+
+    for (uint64_t b = 0; b < bytesA; ++b)
+        m_memory[addrA + b] = static_cast<uint8_t>(valueA >> (8 * b));
+
+    return;
+}
+
+void Simulator::check(const uint32_t lineA, const uint32_t numLinesA, const uint32_t placeA,
+                      const uint32_t numPlacesA, const uint64_t wordIdxA) const
+{
+    if (lineA >= numLinesA || placeA >= numPlacesA)
+        throw AssemblerException("Simulation: Cache line " + std::to_string(lineA) + " or place " +
+                                     std::to_string(placeA) + " out of range at word " + std::to_string(wordIdxA),
+                                 1104);
+
+    return;
+}
+
+void Simulator::compute(void)
+{
+    // Result depends on data only, not on line numbers, thus renamed lines compute the same
+    uint64_t t_hash{0};
+
+    for (uint32_t p = 0; p < m_dicPlaces && m_selected[0] < m_dicLines; ++p)
+        t_hash = mix(t_hash ^ m_dic[m_selected[0] * m_dicPlaces + p]);
+
+    if (m_selected[2] < m_pcLines)
+        t_hash = mix(t_hash ^ m_pc[m_selected[2]]);
+
+    if (m_selected[3] < m_ccLines)
+        t_hash = mix(t_hash ^ m_cc[m_selected[3]]);
+
+    for (uint32_t p = 0; p < m_docPlaces; ++p)
+        m_outputs[p] = mix(t_hash + p);
+
+    m_running = m_selected;
+    m_busy = true;
+    ++m_stats.computations;
+
+    return;
+}
+
+void Simulator::complete(void)
+{
+    if (!m_busy)
+        return;
+
+    for (uint32_t p = 0; p < m_docPlaces && m_running[1] < m_docLines; ++p)
+        m_doc[m_running[1] * m_docPlaces + p] = m_outputs[p];
+
+    m_busy = false;
+
+    return;
+}
+
+} /* End namespace as */
@@ -0,0 +1,129 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "storecoalescing.h"
+#include "loop.h"
+#include <algorithm>
+
+namespace
+{
+
+/**
+ * @brief Check that two shared memory ranges overlap.
+ *
+ * @param firstA Start address of first range.
+ * @param firstSizeA Size of first range.
+ * @param secondA Start address of second range.
+ * @param secondSizeA Size of second range.
+ * @return True if the ranges have a common address.
+ */
+bool overlaps(const uint64_t firstA, const uint64_t firstSizeA, const uint64_t secondA, const uint64_t secondSizeA)
+{
+    return firstA < secondA + secondSizeA && secondA < firstA + firstSizeA;
+}
+
+} // End anonymous namespace
+
+namespace as
+{
+
+StoreCoalescing::StoreCoalescing(const InstructionSet &isaA, const boost::property_tree::ptree &configA)
+    : LineCoalescing(isaA, "STORED", "STOREDA", configA.get<uint32_t>("VCGRA_Property.Num_Doc_Places", 0),
+                     configA.get<uint64_t>("VCGRA_Property.Doc_Place_Stride", 1),
+                     configA.get<uint64_t>("VCGRA_Property.Available_Memory", 0), false),
+      m_loaddId{isaA.getMachineId("LOADD")}, m_loaddaId{isaA.getMachineId("LOADDA")},
+      m_dicStride{std::max<uint64_t>(configA.get<uint64_t>("VCGRA_Property.Dic_Place_Stride", 1), 1)},
+      m_dicLineSize{configA.get<uint64_t>("VCGRA_Property.Num_Dic_Places", 0) *
+                    configA.get<uint64_t>("VCGRA_Property.Dic_Place_Stride", 1)}
+{
+    for (const auto &name : {"START", "WAIT_READY", "FINISH", "LOADPC", "LOADCC"})
+        {
+            auto t_id = isaA.getMachineId(name);
+
+            if (t_id != UINT32_MAX)
+                m_barrierIds.push_back(t_id);
+        }
+
+    return;
+}
+
+std::string StoreCoalescing::getName(void) const
+{
+    return "store-coalescing";
+}
+
+uint64_t StoreCoalescing::run(InstructionStream &streamA)
+{
+    m_savings.clear();
+
+    return LineCoalescing::run(streamA);
+}
+
+void StoreCoalescing::report(std::ostream &osA) const
+{
+    for (const auto &saving : m_savings)
+        {
+            if (saving.first)
+                osA << "    " << saving.first->getReadCommandLine() << " (line " << saving.first->getFileLine()
+                    << "): ";
+            else
+                osA << "    top level: ";
+
+            osA << saving.second << " instructions saved" << std::endl;
+        }
+
+    return;
+}
+
+bool StoreCoalescing::isBarrier(const Instruction &instA, const uint32_t, const uint64_t baseA) const
+{
+    const auto t_id = m_isa.getMachineCode(instA.word);
+    const auto t_address = m_isa.getAddress(instA.word);
+    const auto t_lineSize = std::max<uint64_t>(m_numPlaces * m_stride, 1);
+
+    if (std::find(m_barrierIds.cbegin(), m_barrierIds.cend(), t_id) != m_barrierIds.cend())
+        return true;
+
+    // Memory accesses which depend on the order of the delayed stores (a place covers its stride)
+    if (t_id == m_placeId)
+        return overlaps(t_address, std::max<uint64_t>(m_stride, 1), baseA, t_lineSize);
+    else if (t_id == m_loaddId)
+        return overlaps(t_address, m_dicStride, baseA, t_lineSize);
+    else if (t_id == m_lineId)
+        return overlaps(t_address, t_lineSize, baseA, t_lineSize);
+    else if (t_id == m_loaddaId)
+        return overlaps(t_address, std::max<uint64_t>(m_dicLineSize, 1), baseA, t_lineSize);
+
+    return false;
+}
+
+void StoreCoalescing::coalesced(const Instruction &instA, const uint64_t removedA)
+{
+    auto t_it = std::find_if(m_savings.begin(), m_savings.end(),
+                             [&instA](const std::pair<const Loop *, uint64_t> &savingA) {
+                                 return savingA.first == instA.loop;
+                             });
+
+    if (t_it != m_savings.end())
+        t_it->second += removedA;
+    else
+        m_savings.emplace_back(instA.loop, removedA);
+
+    return;
+}
+
+} /* End namespace as */
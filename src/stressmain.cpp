@@ -0,0 +1,314 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "assembler.h"
+#include "batch.h"
+#include "instrumentation.h"
+#include "kernelgenerator.h"
+#include "myException.h"
+#include "tracer.h"
+#include <boost/filesystem.hpp>
+#include <boost/filesystem/fstream.hpp>
+#include <boost/program_options.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+namespace fs = boost::filesystem;
+namespace pt = boost::property_tree;
+
+/**
+ * @brief Assembler run of the stress test with its single threaded reference result.
+ */
+struct Case
+{
+    std::string name;               //!< @brief Name of case (used for output file names)
+    fs::path file;                  //!< @brief Assembler file
+    unsigned level;                 //!< @brief Optimization level
+    std::string result;             //!< @brief Content of output file or error message of reference run
+    std::vector<uint64_t> counters; //!< @brief Counters of reference run
+    uint64_t events;                //!< @brief Trace events of reference run
+};
+
+/**
+ * @brief Run the assembler and return the content of the output file or the error message.
+ *
+ * @param[in] caseA Case to run.
+ * @param[in] configA Program configuration.
+ * @param[in] outDirA Directory for output file.
+ */
+std::string runCase(const Case &caseA, const pt::ptree &configA, const fs::path &outDirA)
+{
+    fs::path t_file{caseA.file};
+    pt::ptree t_config{configA};
+    const fs::path t_out{outDirA / (caseA.name + ".hpp")};
+    std::ostringstream t_log{};
+
+    t_config.put("General.Output", t_out.string());
+    t_config.put("General.Optimize", caseA.level);
+
+    try
+        {
+            as::Assembler t_as{t_file, t_config, t_log};
+            t_as.parse();
+            t_as.assemble();
+        }
+    catch (const as::AssemblerException &e)
+        {
+            return e.what();
+        }
+
+    fs::ifstream t_is{t_out};
+
+    return std::string{std::istreambuf_iterator<char>{t_is}, std::istreambuf_iterator<char>{}};
+}
+
+/**
+ * @brief Run all cases repeatedly in a thread and count deviations from the reference results.
+ *
+ * @param[in] casesA Cases with reference results.
+ * @param[in] configA Program configuration.
+ * @param[in] outDirA Output directory of thread.
+ * @param[in] offsetA First case of thread (threads interleave different cases).
+ * @param[in] iterationsA Runs of every case.
+ * @param[out] failuresA Number of deviating results and parsed line counts.
+ */
+void stress(const std::vector<Case> &casesA, const pt::ptree &configA, const fs::path &outDirA,
+            const std::size_t offsetA, const uint32_t iterationsA, uint64_t &failuresA)
+{
+    as::Instrumentation t_stats{};
+    uint64_t t_lines{0};
+
+    // Every thread records into its own instrumentation
+    as::Instrumentation::setCurrent(&t_stats);
+
+    for (uint32_t it = 0; it < iterationsA; ++it)
+        for (std::size_t c = 0; c < casesA.size(); ++c)
+            {
+                const Case &t_case = casesA[(offsetA + c) % casesA.size()];
+
+                if (runCase(t_case, configA, outDirA) != t_case.result)
+                    ++failuresA;
+
+                t_lines += t_case.counters[static_cast<uint8_t>(as::Instrumentation::COUNTER::LINES)];
+            }
+
+    if (t_stats.getCounter(as::Instrumentation::COUNTER::LINES) != t_lines)
+        ++failuresA;
+
+    as::Instrumentation::setCurrent(nullptr);
+
+    return;
+}
+
+/**
+ * @brief Assemble the cases without optimization as batch and compare its counters and trace
+ * events with the sum of the reference runs.
+ *
+ * @param[in] casesA Cases with reference results.
+ * @param[in] configA Program configuration.
+ * @param[in] outDirA Output directory of batch.
+ * @param[in] threadsA Worker threads of batch.
+ * @return Number of deviating counters and trace event counts.
+ */
+uint64_t batch(const std::vector<Case> &casesA, const pt::ptree &configA, const fs::path &outDirA,
+               const uint32_t threadsA)
+{
+    pt::ptree t_config{configA};
+    std::vector<uint64_t> t_counters(static_cast<uint8_t>(as::Instrumentation::COUNTER::NUM_COUNTERS), 0);
+    uint64_t t_events{0};
+
+    t_config.put("General.Output", (outDirA / "Assembler.hpp").string());
+    t_config.put("General.Optimize", 0);
+
+    as::Batch t_batch{t_config, threadsA};
+
+    for (const auto &c : casesA)
+        if (c.level == 0)
+            {
+                t_batch.add(c.file);
+                t_events += c.events;
+
+                for (std::size_t k = 0; k < t_counters.size(); ++k)
+                    t_counters[k] += c.counters[k];
+            }
+
+    // Workers of the batch record into the instrumentation and tracer of this thread
+    as::Instrumentation t_stats{};
+    as::Tracer t_tracer{};
+    std::ostringstream t_os{};
+
+    as::Instrumentation::setCurrent(&t_stats);
+    as::Tracer::setCurrent(&t_tracer);
+    t_batch.run(t_os);
+    as::Instrumentation::setCurrent(nullptr);
+    as::Tracer::setCurrent(nullptr);
+
+    uint64_t t_failures{t_tracer.size() != t_events};
+
+    for (std::size_t k = 0; k < t_counters.size(); ++k)
+        t_failures += t_stats.getCounter(static_cast<as::Instrumentation::COUNTER>(k)) != t_counters[k];
+
+    return t_failures;
+}
+
+} // end of anonymous namespace
+
+int main(int argc, char *argv[])
+{
+    namespace po = boost::program_options;
+    //!< @brief Abbreviation for boost program options library.
+
+    /* Define command line options for stress test.
+       help: Shows cmd-tool options
+       config: Assembler configuration file.
+       work-dir: Directory for generated programs and output files.
+       threads: Number of concurrent assemblers.
+       iterations: Runs of every case per thread.
+       programs: Number of generated programs (each assembled with -O0 and -O2).
+     */
+    po::options_description desc("Usable options");
+    desc.add_options()("help,", "Show command line options and usability.")(
+        "config,", po::value<std::string>()->default_value("examples/config.xml"), "Assembler configuration file.")(
+        "work-dir,", po::value<std::string>()->default_value("stress"), "Directory for programs and output files.")(
+        "threads,", po::value<uint32_t>()->default_value(8), "Number of concurrent assemblers.")(
+        "iterations,", po::value<uint32_t>()->default_value(4), "Runs of every case per thread.")(
+        "programs,", po::value<uint32_t>()->default_value(3), "Number of generated programs.");
+
+    po::variables_map vm;
+    //!< \brief Variable map to store command line options.
+
+    try
+        {
+            po::store(po::parse_command_line(argc, argv, desc), vm);
+            po::notify(vm);
+        }
+    catch (const po::error &e)
+        {
+            std::cout << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    if (vm.count("help") != 0U)
+        {
+            std::cout << desc << std::endl;
+            return EXIT_SUCCESS;
+        }
+
+    const fs::path t_workDir{vm["work-dir"].as<std::string>()};
+    const uint32_t t_threads = vm["threads"].as<uint32_t>();
+    pt::ptree t_config{};
+    std::vector<Case> t_cases{};
+
+    try
+        {
+            pt::read_xml(vm["config"].as<std::string>(), t_config);
+            fs::create_directories(t_workDir);
+
+            // Generated programs, each without and with optimization
+            as::KernelGenerator t_gen{t_config};
+            as::KernelGenerator::Parameters t_param{};
+
+            for (uint32_t p = 0; p < vm["programs"].as<uint32_t>(); ++p)
+                {
+                    const std::string t_name{"generated" + std::to_string(p + 1)};
+                    const fs::path t_path{t_workDir / (t_name + ".asm")};
+                    fs::ofstream t_os{t_path};
+
+                    t_param.seed = p + 1;
+                    t_gen.generate(t_param, t_os);
+
+                    for (const unsigned level : {0u, 2u})
+                        t_cases.push_back(Case{t_name + "_O" + std::to_string(level), t_path, level, "", {}, 0});
+                }
+
+            // Program with syntax error to throw exceptions concurrently
+            const fs::path t_faulty{t_workDir / "faulty.asm"};
+            fs::ofstream t_os{t_faulty};
+            t_os << "LOOP 0 4 0\nPOOL\n";
+            t_os.close();
+            t_cases.push_back(Case{"faulty", t_faulty, 0, "", {}, 0});
+
+            // Single threaded reference results
+            for (auto &c : t_cases)
+                {
+                    as::Instrumentation t_stats{};
+                    as::Tracer t_tracer{};
+                    as::Instrumentation::setCurrent(&t_stats);
+                    as::Tracer::setCurrent(&t_tracer);
+
+                    c.result = runCase(c, t_config, t_workDir);
+                    c.events = t_tracer.size();
+
+                    for (uint8_t k = 0; k < static_cast<uint8_t>(as::Instrumentation::COUNTER::NUM_COUNTERS); ++k)
+                        c.counters.push_back(t_stats.getCounter(static_cast<as::Instrumentation::COUNTER>(k)));
+
+                    as::Instrumentation::setCurrent(nullptr);
+                    as::Tracer::setCurrent(nullptr);
+                }
+        }
+    catch (const std::exception &e)
+        {
+            std::cout << "Error while preparing stress test: " << e.what() << std::endl;
+            return EXIT_FAILURE;
+        }
+
+    // Concurrent assemblers
+    std::vector<std::thread> t_pool{};
+    std::vector<uint64_t> t_failures(t_threads, 0);
+
+    for (uint32_t t = 0; t < t_threads; ++t)
+        {
+            const fs::path t_outDir{t_workDir / ("thread" + std::to_string(t))};
+            fs::create_directories(t_outDir);
+
+            t_pool.emplace_back(stress, std::cref(t_cases), std::cref(t_config), t_outDir, std::size_t{t},
+                                vm["iterations"].as<uint32_t>(), std::ref(t_failures[t]));
+        }
+
+    uint64_t t_total{0};
+
+    for (uint32_t t = 0; t < t_threads; ++t)
+        {
+            t_pool[t].join();
+            t_total += t_failures[t];
+
+            if (t_failures[t] != 0)
+                std::cout << "Thread " << t << ": " << t_failures[t] << " deviations from reference" << std::endl;
+        }
+
+    // Batch on the same number of threads, its counters are the sum over all jobs
+    const uint64_t t_batchFailures = batch(t_cases, t_config, t_workDir / "batch", t_threads);
+    t_total += t_batchFailures;
+
+    if (t_batchFailures != 0)
+        std::cout << "Batch: " << t_batchFailures << " counters deviate from sum of jobs" << std::endl;
+
+    std::cout << t_threads << " threads x " << vm["iterations"].as<uint32_t>() << " iterations x " << t_cases.size()
+              << " cases: " << (t_total == 0 ? "passed" : "FAILED") << std::endl;
+
+    return t_total == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -24,7 +24,7 @@
 
 namespace as
 {
-Sub::Sub(Level *lvlA, const std::string &cmdLineA, const uint32_t lineNumberA, ParseObjBase *const firstA,
+Sub::Sub(Level *lvlA, const std::string &cmdLineA, const uint64_t lineNumberA, ParseObjBase *const firstA,
          ParseObjBase *const secondA)
     : IArithmetic{lvlA, cmdLineA, lineNumberA, firstA, secondA}
 {
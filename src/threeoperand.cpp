@@ -23,7 +23,7 @@
 #include <sstream>
 #include <utility>
 
-as::ThreeOperand::ThreeOperand(as::Level *const lvlA, const std::string &cmdLineA, const uint32_t lineNumberA,
+as::ThreeOperand::ThreeOperand(as::Level *const lvlA, const std::string &cmdLineA, const uint64_t lineNumberA,
                                as::ParseObjBase *const firstA, as::ParseObjBase *const secondA,
                                as::ParseObjBase *const thridA, const uint32_t machienIdA)
     : as::ParseObjBase{lvlA, as::COMMANDCLASS::THREEOPERAND, cmdLineA, lineNumberA}, m_first{firstA}, m_second{secondA},
@@ -161,7 +161,17 @@ as::ThreeOperand::operands_type_t as::ThreeOperand::setOperands(const as::ThreeO
 std::string as::ThreeOperand::assemble(const boost::property_tree::ptree &ptreeA)
 {
     // Temporary variables
-    std::ostringstream t_os{""};                                               // Formated machine code command
+    std::ostringstream t_os{""}; // Formated machine code command
+    auto t_word = this->encode(ptreeA);
+
+    t_os << "\"" << m_fmtStr % (t_word >> 16) % (t_word & 0xFFFF) << "\"";
+
+    return t_os.str();
+}
+
+uint64_t as::ThreeOperand::encode(const boost::property_tree::ptree &ptreeA)
+{
+    // Temporary variables
     auto t_OpcodeSize = ptreeA.get<uint32_t>("Assembler_Property.OpCodeSize"); // Opcode size in machine code signal
     auto t_PlaceSize = ptreeA.get<uint32_t>("Assembler_Property.PlaceSize");   // Places size in machine code signal
     auto t_MemorySize =
@@ -244,9 +254,7 @@ std::string as::ThreeOperand::assemble(const boost::property_tree::ptree &ptreeA
     else
         throw as::AssemblerException("Selected cache line is not available or address is out of memory.", 8815);
 
-    t_os << "\"" << m_fmtStr % t_valFirst % t_valSecond << "\"";
-
-    return t_os.str();
+    return (static_cast<uint64_t>(t_valFirst) << 16) | t_valSecond;
 }
 
 std::ostream &operator<<(std::ostream &osA, const as::ThreeOperand &opA)
@@ -0,0 +1,173 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "tracer.h"
+#include <iomanip>
+
+namespace
+{
+
+/**
+ * @brief Quote a string for JSON.
+ */
+std::string quote(const std::string &strA)
+{
+    std::string t_str{"\""};
+
+    for (const char c : strA)
+        {
+            if (c == '"' || c == '\\')
+                t_str += '\\';
+
+            t_str += (c == '\n' || c == '\t') ? ' ' : c;
+        }
+
+    return t_str + "\"";
+}
+
+} // end of anonymous namespace
+
+namespace as
+{
+
+thread_local Tracer *Tracer::current = nullptr;
+
+Tracer::Span::Span(const char *nameA, const char *categoryA)
+    : m_tracer{current}, m_name{}, m_category{categoryA}, m_begin{}, m_args{}
+{
+    if (m_tracer)
+        {
+            m_name = nameA;
+            m_begin = std::chrono::steady_clock::now();
+        }
+
+    return;
+}
+
+Tracer::Span::Span(const std::string &nameA, const char *categoryA)
+    : m_tracer{current}, m_name{}, m_category{categoryA}, m_begin{}, m_args{}
+{
+    if (m_tracer)
+        {
+            m_name = nameA;
+            m_begin = std::chrono::steady_clock::now();
+        }
+
+    return;
+}
+
+Tracer::Span::~Span(void)
+{
+    if (!m_tracer)
+        return;
+
+    auto t_end = std::chrono::steady_clock::now();
+
+    m_tracer->m_events.push_back(
+        Event{std::move(m_name), m_category,
+              std::chrono::duration<double, std::micro>(m_begin - m_tracer->m_start).count(),
+              std::chrono::duration<double, std::micro>(t_end - m_begin).count(), std::move(m_args), 1});
+}
+
+void Tracer::Span::addArg(const char *keyA, const uint64_t valueA)
+{
+    if (m_tracer)
+        m_args += (m_args.empty() ? "" : ", ") + quote(keyA) + ": " + std::to_string(valueA);
+
+    return;
+}
+
+void Tracer::Span::addArg(const char *keyA, const std::string &valueA)
+{
+    if (m_tracer)
+        m_args += (m_args.empty() ? "" : ", ") + quote(keyA) + ": " + quote(valueA);
+
+    return;
+}
+
+Tracer::Tracer(void) : m_start{std::chrono::steady_clock::now()}, m_events{}
+{
+    return;
+}
+
+Tracer::~Tracer(void)
+{
+    if (current == this)
+        current = nullptr;
+}
+
+void Tracer::setCurrent(Tracer *tracerA)
+{
+    current = tracerA;
+    return;
+}
+
+Tracer *Tracer::getCurrent(void)
+{
+    return current;
+}
+
+bool Tracer::isAvailable(void)
+{
+#ifdef CGRA_ENABLE_TRACE
+    return true;
+#else
+    return false;
+#endif
+}
+
+uint64_t Tracer::size(void) const
+{
+    return m_events.size();
+}
+
+void Tracer::merge(const Tracer &otherA, const uint32_t threadA)
+{
+    const double t_offset = std::chrono::duration<double, std::micro>(otherA.m_start - m_start).count();
+
+    for (const auto &event : otherA.m_events)
+        m_events.push_back(
+            Event{event.name, event.category, event.begin + t_offset, event.duration, event.args, threadA});
+
+    return;
+}
+
+void Tracer::write(std::ostream &osA) const
+{
+    osA << "{\"traceEvents\": [";
+
+    for (std::size_t e = 0; e < m_events.size(); ++e)
+        {
+            const Event &t_event = m_events[e];
+
+            osA << (e != 0 ? "," : "") << "\n{\"name\": " << quote(t_event.name) << ", \"cat\": "
+                << quote(t_event.category) << ", \"ph\": \"X\", \"ts\": " << std::fixed << std::setprecision(3)
+                << t_event.begin << ", \"dur\": " << t_event.duration << std::defaultfloat
+                << ", \"pid\": 1, \"tid\": " << t_event.thread;
+
+            if (!t_event.args.empty())
+                osA << ", \"args\": {" << t_event.args << "}";
+
+            osA << "}";
+        }
+
+    osA << "\n],\n\"displayTimeUnit\": \"ms\"}" << std::endl;
+
+    return;
+}
+
+} /* End namespace as */
@@ -32,7 +32,7 @@ as::TwoOperand::TwoOperand(const TwoOperand &srcA)
     return;
 }
 
-as::TwoOperand::TwoOperand(as::Level *const lvlA, const std::string &cmdLineA, const uint32_t lineNumberA,
+as::TwoOperand::TwoOperand(as::Level *const lvlA, const std::string &cmdLineA, const uint64_t lineNumberA,
                            as::ParseObjBase *const firstA, as::ParseObjBase *const secondA, const uint32_t machineIdA)
     : as::ParseObjBase{lvlA, as::COMMANDCLASS::TWOOPERAND, cmdLineA, lineNumberA}, m_first{firstA}, m_second{secondA},
       m_machineCodeId{machineIdA}
@@ -135,7 +135,17 @@ uint32_t as::TwoOperand::setMachineCodeId(const uint32_t machineIdA)
 std::string as::TwoOperand::assemble(const boost::property_tree::ptree &ptreeA)
 {
     // Temporary variables
-    std::ostringstream t_os{""};                                               // Formated machine code command
+    std::ostringstream t_os{""}; // Formated machine code command
+    auto t_word = this->encode(ptreeA);
+
+    t_os << "\"" << m_fmtStr % (t_word >> 16) % (t_word & 0xFFFF) << "\"";
+
+    return t_os.str();
+}
+
+uint64_t as::TwoOperand::encode(const boost::property_tree::ptree &ptreeA)
+{
+    // Temporary variables
     auto t_OpcodeSize = ptreeA.get<uint32_t>("Assembler_Property.OpCodeSize"); // Opcode size in machine code signal
     auto t_PlaceSize = ptreeA.get<uint32_t>("Assembler_Property.PlaceSize");   // Places size in machine code signal
     auto t_MemorySize =
@@ -212,9 +222,7 @@ std::string as::TwoOperand::assemble(const boost::property_tree::ptree &ptreeA)
     else
         throw as::AssemblerException("Selected cache line is not available or address is out of memory.", 8715);
 
-    t_os << "\"" << m_fmtStr % t_valFirst % t_valSecond << "\"";
-
-    return t_os.str();
+    return (static_cast<uint64_t>(t_valFirst) << 16) | t_valSecond;
 }
 
 void as::TwoOperand::clearMembers()
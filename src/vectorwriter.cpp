@@ -0,0 +1,69 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "vectorwriter.h"
+#include "myException.h"
+#include "tracer.h"
+#include <fstream>
+
+namespace as
+{
+
+VectorWriter::VectorWriter(const boost::property_tree::ptree &configA) : IOutputWriter{configA}
+{
+    return;
+}
+
+std::vector<boost::filesystem::path> VectorWriter::write(const InstructionStream &streamA,
+                                                         const boost::filesystem::path &outPathA)
+{
+    // Opening file to store machine code.
+    CGRA_TRACE_SPAN("flush", "output");
+    CGRA_TRACE_ARG("file", outPathA.string());
+    CGRA_TRACE_ARG("words", streamA.size());
+    std::filebuf t_fb;
+
+    if (t_fb.open(outPathA.c_str(), std::ios::out))
+        {
+            std::ostream t_codeFile(&t_fb);
+            const auto t_guard = getGuardName(outPathA);
+
+            t_codeFile << "#ifndef " << t_guard << "\n";
+            t_codeFile << "#define " << t_guard << "\n\n\n";
+
+            writeInclude(t_codeFile);
+            t_codeFile << "#include <vector>\n\n";
+            t_codeFile << "namespace cgra \n{\n\n";
+            t_codeFile << "std::vector<cgra::TopLevel::assembler_type_t> assembly{\n";
+
+            for (auto it = streamA.cbegin(); it != streamA.cend(); ++it)
+                writeStringWord(t_codeFile, *it);
+
+            t_codeFile << "};\n\n";
+            t_codeFile << "} //End namespace cgra\n\n";
+            t_codeFile << "#endif //" << t_guard << "\n";
+            t_fb.close();
+        }
+    else
+        {
+            throw AssemblerException("Error while opening output file.", 4500);
+        }
+
+    return std::vector<boost::filesystem::path>{outPathA};
+}
+
+} /* End namespace as */
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2019  andrewerner <andre.werner-w2m@ruhr-uni-bochum.de>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "waitsinking.h"
+#include <utility>
+
+namespace as
+{
+
+WaitSinking::WaitSinking(const InstructionSet &isaA)
+    : m_isa{isaA}, m_start{isaA.getMachineId("START")}, m_wait{isaA.getMachineId("WAIT_READY")},
+      m_selectIds{{isaA.getMachineId("SLCT_DIC_LINE"), isaA.getMachineId("SLCT_PECC_LINE"),
+                   isaA.getMachineId("SLCT_CHCC_LINE")}},
+      m_loadIds{{isaA.getMachineId("LOADDA"), isaA.getMachineId("LOADPC"), isaA.getMachineId("LOADCC")}},
+      m_loadd{isaA.getMachineId("LOADD")}, m_hoisted{0}
+{
+    return;
+}
+
+std::string WaitSinking::getName(void) const
+{
+    return "wait-sinking";
+}
+
+uint64_t WaitSinking::run(InstructionStream &streamA)
+{
+    m_hoisted = 0;
+
+    if (m_wait == UINT32_MAX)
+        return 0;
+
+    std::vector<Instruction> &t_insts = streamA.getInstructions();
+    // Selected line of DIC, PECC and CHCC, UINT32_MAX if unknown
+    std::array<uint32_t, 3> t_selected;
+    t_selected.fill(UINT32_MAX);
+    // Lines used by the running computation, latched at its START
+    std::array<uint32_t, 3> t_latched;
+    t_latched.fill(UINT32_MAX);
+    uint64_t t_moved{0};
+
+    // Check that instruction is a load into a cache line which is not used by the computation
+    auto independentLoad = [&](const uint64_t wordA) {
+        const auto t_id = m_isa.getMachineCode(wordA);
+        const auto t_line = m_isa.getLine(wordA);
+
+        for (std::size_t c = 0; c < m_loadIds.size(); ++c)
+            {
+                if ((t_id == m_loadIds[c] || (c == 0 && t_id == m_loadd)) && t_id != UINT32_MAX)
+                    return t_latched[c] != UINT32_MAX && t_latched[c] != t_line;
+            }
+
+        return false;
+    };
+
+    for (uint64_t i = 0; i < t_insts.size(); ++i)
+        {
+            const auto t_id = m_isa.getMachineCode(t_insts[i].word);
+
+            if (t_id == m_wait)
+                {
+                    uint64_t j = i;
+
+                    // Move WAIT_READY down as long as the next instruction is independent
+                    while (j + 1 < t_insts.size() && independentLoad(t_insts[j + 1].word))
+                        {
+                            std::swap(t_insts[j], t_insts[j + 1]);
+                            ++j;
+                        }
+
+                    if (j != i)
+                        {
+                            ++t_moved;
+                            m_hoisted += j - i;
+                        }
+
+                    i = j;
+                    continue;
+                }
+
+            if (t_id == m_start && t_id != UINT32_MAX)
+                t_latched = t_selected;
+
+            for (std::size_t c = 0; c < m_selectIds.size(); ++c)
+                {
+                    if (t_id == m_selectIds[c] && t_id != UINT32_MAX)
+                        t_selected[c] = m_isa.getLine(t_insts[i].word);
+                }
+        }
+
+    return t_moved;
+}
+
+void WaitSinking::report(std::ostream &osA) const
+{
+    osA << "    " << m_hoisted << " instructions moved in front of WAIT_READY" << std::endl;
+
+    return;
+}
+
+} /* End namespace as */